@@ -0,0 +1,374 @@
+// Copyright (c) 2014, Michael Boyle
+// See LICENSE file for details
+
+// Timing harness for the C++ core.  Each benchmark runs on synthetic
+// PN waveforms resampled to the requested number of time steps and
+// truncated to the requested ellMax.  Results are written as JSON, so
+// that runs from different versions of the code can be compared.
+//
+// Usage:
+//
+//   Benchmarks [--ntimes N1,N2,...] [--ellmax L1,L2,...] [--repeat R]
+//              [--filter Substring] [--output FileName]
+//
+// Progress is reported on stderr.  Note that some of the functions
+// being timed write to stdout, which is why the JSON goes to a file.
+
+#include <vector>
+#include <string>
+#include <complex>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+
+#include "Waveforms.hpp"
+#include "PNWaveforms.hpp"
+#include "Scri.hpp"
+#include "WaveformsAtAPointFT.hpp"
+#include "Utilities.hpp"
+#include "Quaternions.hpp"
+#include "Errors.hpp"
+
+#ifndef CodeRevision
+#define CodeRevision "unknown"
+#endif
+
+using std::vector;
+using std::string;
+using std::complex;
+using Quaternions::Quaternion;
+
+namespace {
+
+  struct Options {
+    vector<unsigned int> NTimes;
+    vector<unsigned int> EllMax;
+    unsigned int Repeat;
+    string Filter;
+    string Output;
+    Options() : NTimes(1, 20000), EllMax(1, 8), Repeat(5), Filter(""), Output("bench.json") { }
+  };
+
+  struct Result {
+    string Name;
+    unsigned int NTimes, EllMax, Repeat;
+    double Min, Median, Mean;
+    int Error;
+  };
+
+  vector<unsigned int> ParseList(const string& Arg) {
+    vector<unsigned int> List;
+    std::istringstream iss(Arg);
+    string Item;
+    while(std::getline(iss, Item, ',')) {
+      List.push_back(std::atoi(Item.c_str()));
+    }
+    return List;
+  }
+
+  Options ParseOptions(int argc, char* argv[]) {
+    Options Opts;
+    for(int i=1; i<argc; ++i) {
+      const string Arg(argv[i]);
+      if(i+1>=argc) {
+        std::cerr << "Missing value for argument '" << Arg << "'" << std::endl;
+        std::exit(1);
+      }
+      const string Value(argv[++i]);
+      if(Arg=="--ntimes") {
+        Opts.NTimes = ParseList(Value);
+      } else if(Arg=="--ellmax") {
+        Opts.EllMax = ParseList(Value);
+      } else if(Arg=="--repeat") {
+        Opts.Repeat = std::max(1, std::atoi(Value.c_str()));
+      } else if(Arg=="--filter") {
+        Opts.Filter = Value;
+      } else if(Arg=="--output") {
+        Opts.Output = Value;
+      } else {
+        std::cerr << "Unknown argument '" << Arg << "'" << std::endl;
+        std::exit(1);
+      }
+    }
+    return Opts;
+  }
+
+  string JSONString(const string& s) {
+    std::ostringstream oss;
+    oss << '"';
+    for(unsigned int i=0; i<s.size(); ++i) {
+      const char c = s[i];
+      if(c=='"' || c=='\\') { oss << '\\' << c; }
+      else if(c=='\n') { oss << "\\n"; }
+      else if(static_cast<unsigned char>(c)<0x20) { oss << ' '; }
+      else { oss << c; }
+    }
+    oss << '"';
+    return oss.str();
+  }
+
+  // A precessing PN waveform, resampled uniformly to NTimes steps,
+  // with only the modes up to EllMax
+  GWFrames::Waveform SyntheticWaveform(const unsigned int NTimes, const unsigned int EllMax) {
+    vector<double> chi1(3), chi2(3);
+    chi1[0] = 0.1; chi1[1] = 0.2; chi1[2] = 0.3;
+    chi2[0] = -0.2; chi2[1] = 0.0; chi2[2] = 0.1;
+    const GWFrames::PNWaveform PN("TaylorT1", 0.0, chi1, chi2, 0.02);
+    vector<double> T(NTimes);
+    const double t0 = PN.T(0);
+    const double dt = (PN.T(PN.NTimes()-1)-t0)/(NTimes-1);
+    for(unsigned int i=0; i<NTimes; ++i) {
+      T[i] = t0 + i*dt;
+    }
+    T.back() = PN.T(PN.NTimes()-1);
+    GWFrames::Waveform W = PN.Interpolate(T);
+    vector<unsigned int> Drop;
+    for(unsigned int ell=EllMax+1; ell<=PNWaveforms_ellMax; ++ell) {
+      Drop.push_back(ell);
+    }
+    if(Drop.size()>0) { W.DropEllModes(Drop); }
+    return W;
+  }
+
+  // The same data as W, with all modes from ell=0 (filled with zero
+  // where W has none) and the given spin weight, as needed by Scri
+  GWFrames::Waveform AllModes(const GWFrames::Waveform& W, const int SpinWeight) {
+    const int EllMax = W.EllMax();
+    vector<vector<int> > LM;
+    vector<vector<complex<double> > > Data;
+    for(int ell=0; ell<=EllMax; ++ell) {
+      for(int m=-ell; m<=ell; ++m) {
+        vector<int> lm(2);
+        lm[0] = ell;
+        lm[1] = m;
+        LM.push_back(lm);
+        const unsigned int i_m = W.FindModeIndexWithoutError(ell, m);
+        if(i_m<W.NModes()) {
+          Data.push_back(W.Data(i_m));
+        } else {
+          Data.push_back(vector<complex<double> >(W.NTimes(), 0.0));
+        }
+      }
+    }
+    GWFrames::Waveform A(W.T(), LM, Data);
+    A.SetSpinWeight(SpinWeight);
+    return A;
+  }
+
+  // Time Run (after Setup, which is not timed) Repeat times
+  Result Time(const string& Name, const unsigned int NTimes, const unsigned int EllMax, const unsigned int Repeat,
+              const std::function<void()>& Setup, const std::function<void()>& Run) {
+    Result R;
+    R.Name = Name;
+    R.NTimes = NTimes;
+    R.EllMax = EllMax;
+    R.Repeat = Repeat;
+    R.Min = R.Median = R.Mean = 0.0;
+    R.Error = 0;
+    std::cerr << "  " << std::left << std::setw(40) << Name << std::flush;
+    vector<double> Seconds;
+    try {
+      for(unsigned int i=0; i<Repeat; ++i) {
+        Setup();
+        const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+        Run();
+        const std::chrono::steady_clock::time_point Stop = std::chrono::steady_clock::now();
+        Seconds.push_back(std::chrono::duration<double>(Stop-Start).count());
+      }
+    } catch(int Thrown) {
+      std::cerr << "threw " << Thrown << std::endl;
+      R.Error = Thrown;
+      return R;
+    }
+    std::sort(Seconds.begin(), Seconds.end());
+    R.Min = Seconds.front();
+    R.Median = (Seconds.size()%2==1 ? Seconds[Seconds.size()/2]
+                : 0.5*(Seconds[Seconds.size()/2-1]+Seconds[Seconds.size()/2]));
+    for(unsigned int i=0; i<Seconds.size(); ++i) { R.Mean += Seconds[i]; }
+    R.Mean /= Seconds.size();
+    std::cerr << std::scientific << std::setprecision(3) << R.Min << " s" << std::endl;
+    return R;
+  }
+
+  void RunBenchmarks(const unsigned int NTimes, const unsigned int EllMax, const Options& Opts, vector<Result>& Results) {
+    std::cerr << "NTimes=" << NTimes << ", ellMax=" << EllMax << std::endl;
+    const unsigned int Repeat = Opts.Repeat;
+    const std::function<void()> NoSetup = [](){ };
+
+    // B is A, slightly shifted in time and rotated, so that the two
+    // overlap over most of their length, as needed for comparisons
+    const GWFrames::Waveform A = SyntheticWaveform(NTimes, EllMax);
+    const vector<double>& T = A.T();
+    GWFrames::Waveform B(A);
+    vector<double> T_B(T);
+    for(unsigned int i=0; i<NTimes; ++i) { T_B[i] += 2.0; }
+    B.SetTime(T_B);
+    B.RotatePhysicalSystem(Quaternion(std::cos(0.005), std::sin(0.005), 0, 0));
+    const double t_1 = T[NTimes/3];
+    const double t_2 = T[NTimes/2];
+    GWFrames::Waveform Scratch, ScratchB;
+
+    std::function<void(const string&, const std::function<void()>&, const std::function<void()>&)> Add =
+      [&](const string& Name, const std::function<void()>& Setup, const std::function<void()>& Run) {
+      if(Name.find(Opts.Filter)==string::npos) { return; }
+      Results.push_back(Time(Name, NTimes, EllMax, Repeat, Setup, Run));
+    };
+
+    { // TransformModesToRotatedFrame is private; this is its thinnest public wrapper
+      vector<Quaternion> R(NTimes);
+      for(unsigned int i=0; i<NTimes; ++i) {
+        const double theta = 0.1*std::sin(1e-3*T[i]);
+        const double phi = 1e-3*T[i];
+        R[i] = Quaternion(std::cos(phi/2), 0, 0, std::sin(phi/2)) * Quaternion(std::cos(theta/2), 0, std::sin(theta/2), 0);
+      }
+      Add("TransformModesToRotatedFrame",
+          [&](){ Scratch = A; },
+          [&](){ Scratch.RotateDecompositionBasis(R); });
+    }
+
+    Add("LLMatrix", NoSetup, [&](){ A.LLMatrix(); });
+
+    {
+      vector<double> NewT(2*NTimes-1);
+      for(unsigned int i=0; i<NewT.size(); ++i) {
+        NewT[i] = (i%2==0 ? T[i/2] : 0.5*(T[i/2]+T[i/2+1]));
+      }
+      Add("Interpolate", NoSetup, [&](){ A.Interpolate(NewT); });
+    }
+
+    {
+      // A coarse grid of sky points, as for antenna-pattern studies
+      const unsigned int NPoints = 200;
+      vector<double> vartheta(NPoints), varphi(NPoints);
+      for(unsigned int i=0; i<NPoints; ++i) {
+        vartheta[i] = M_PI*(i+0.5)/NPoints;
+        varphi[i] = 2*M_PI*((i*0.6180339887498949) - std::floor(i*0.6180339887498949));
+      }
+      Add("EvaluateAtPoints", NoSetup, [&](){ A.EvaluateAtPoints(vartheta, varphi); });
+    }
+
+    Add("Compare", NoSetup, [&](){ A.Compare(B); });
+
+    Add("Hybridize", NoSetup, [&](){ A.Hybridize(B, t_1, t_2); });
+
+    {
+      GWFrames::Waveform A_corot = A;
+      GWFrames::Waveform B_corot = B;
+      if(Opts.Filter.size()==0 || string("AlignWaveforms").find(Opts.Filter)!=string::npos) {
+        A_corot.TransformToCorotatingFrame();
+        B_corot.TransformToCorotatingFrame();
+      }
+      Add("AlignWaveforms",
+          [&](){ Scratch = A_corot; ScratchB = B_corot; },
+          [&](){ GWFrames::AlignWaveforms(Scratch, ScratchB, t_1, t_2); });
+    }
+
+    {
+      vector<vector<double> > deltax(NTimes, vector<double>(3));
+      vector<vector<double> > v(NTimes, vector<double>(3));
+      for(unsigned int i=0; i<NTimes; ++i) {
+        deltax[i][0] = 0.1; deltax[i][1] = -0.2; deltax[i][2] = 1e-4*T[i];
+        v[i][0] = 1e-3; v[i][1] = 2e-3; v[i][2] = -1e-3;
+      }
+      Add("Translate", NoSetup, [&](){ A.Translate(deltax); });
+      Add("BoostPsi4",
+          [&](){ Scratch = A; },
+          [&](){ Scratch.BoostPsi4(v); });
+    }
+
+    // The curvature scalars are stand-ins with the right spin weights;
+    // only the cost of the transformations matters here
+    const bool NeedScri = (string("Scri::BMSTransformation").find(Opts.Filter)!=string::npos
+                           || string("SuperMomenta::MoreschiIteration").find(Opts.Filter)!=string::npos);
+    if(NeedScri) {
+      const GWFrames::Scri scri(AllModes(A,2), AllModes(A,1), AllModes(A,0), AllModes(A,-1), AllModes(A,-2), AllModes(A,2));
+      const int N_lm = (EllMax+1)*(EllMax+1);
+      const double u0 = 0.5*(t_1+t_2);
+      vector<complex<double> > Zeros(N_lm, 0.0);
+      const GWFrames::Modes delta(0, Zeros);
+      vector<double> v(3, 0.0);
+      v[0] = 1e-3;
+      Add("Scri::BMSTransformation", NoSetup, [&](){ scri.BMSTransformation(u0, v, delta); });
+
+      const GWFrames::SuperMomenta PsiM(scri);
+      vector<complex<double> > OneOverK0(Zeros), delta0(Zeros);
+      OneOverK0[0] = std::sqrt(4*M_PI);
+      delta0[0] = u0*std::sqrt(4*M_PI);
+      GWFrames::Modes OneOverK, delta_i;
+      Add("SuperMomenta::MoreschiIteration",
+          [&](){ OneOverK = GWFrames::Modes(0, OneOverK0); delta_i = GWFrames::Modes(0, delta0); },
+          [&](){ PsiM.MoreschiIteration(OneOverK, delta_i); });
+    }
+
+    if(string("WaveformAtAPointFT::Match").find(Opts.Filter)!=string::npos) {
+      const double Dt = (T.back()-T[0])/NTimes;
+      const GWFrames::WaveformAtAPointFT FT_A(A, Dt, 0.3, 0.5, 20.0);
+      const GWFrames::WaveformAtAPointFT FT_B(B, Dt, 0.3, 0.5, 20.0);
+      const vector<double> InversePSD = FT_A.InversePSD();
+      Add("WaveformAtAPointFT::Match", NoSetup, [&](){ FT_A.Match(FT_B, InversePSD); });
+    }
+  }
+
+  void WriteJSON(const Options& Opts, const vector<Result>& Results) {
+    std::ofstream ofs(Opts.Output.c_str());
+    if(!ofs.is_open()) {
+      std::cerr << "Couldn't open '" << Opts.Output << "' for writing" << std::endl;
+      throw(GWFrames_BadFileName);
+    }
+    std::ostringstream Revision;
+    Revision << CodeRevision;
+    const std::time_t Now = std::time(0);
+    char Date[32];
+    std::strftime(Date, sizeof(Date), "%Y-%m-%dT%H:%M:%S", std::gmtime(&Now));
+    ofs << std::setprecision(6) << std::scientific;
+    ofs << "{\n"
+        << "  \"context\": {\n"
+        << "    \"code_revision\": " << JSONString(Revision.str()) << ",\n"
+        << "    \"date\": " << JSONString(Date) << ",\n"
+        << "    \"threads\": " << GWFrames::NumThreads() << ",\n"
+        << "    \"repeat\": " << Opts.Repeat << "\n"
+        << "  },\n"
+        << "  \"benchmarks\": [";
+    for(unsigned int i=0; i<Results.size(); ++i) {
+      const Result& R = Results[i];
+      ofs << (i==0 ? "\n" : ",\n")
+          << "    {\"name\": " << JSONString(R.Name)
+          << ", \"ntimes\": " << R.NTimes
+          << ", \"ellmax\": " << R.EllMax
+          << ", \"repeat\": " << R.Repeat;
+      if(R.Error!=0) {
+        ofs << ", \"error\": " << R.Error << "}";
+      } else {
+        ofs << ", \"min\": " << R.Min
+            << ", \"median\": " << R.Median
+            << ", \"mean\": " << R.Mean << "}";
+      }
+    }
+    ofs << "\n  ]\n}\n";
+  }
+
+}
+
+int main(int argc, char* argv[]) {
+  const Options Opts = ParseOptions(argc, argv);
+  vector<Result> Results;
+  for(unsigned int i_N=0; i_N<Opts.NTimes.size(); ++i_N) {
+    for(unsigned int i_L=0; i_L<Opts.EllMax.size(); ++i_L) {
+      if(Opts.EllMax[i_L]<2 || Opts.EllMax[i_L]>PNWaveforms_ellMax) {
+        std::cerr << "ellMax must be between 2 and " << PNWaveforms_ellMax << "; skipping " << Opts.EllMax[i_L] << std::endl;
+        continue;
+      }
+      RunBenchmarks(Opts.NTimes[i_N], Opts.EllMax[i_L], Opts, Results);
+    }
+  }
+  WriteJSON(Opts, Results);
+  std::cerr << "Wrote " << Results.size() << " results to " << Opts.Output << std::endl;
+  return 0;
+}
@@ -59,7 +59,9 @@ GWFrames::PNWaveform::PNWaveform() :
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history.str("");
     history.clear();
     history << "### Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << std::endl
@@ -79,6 +81,39 @@ GWFrames::PNWaveform::PNWaveform(const PNWaveform& a) :
   history.seekp(0, std::ios_base::end);
 }
 
+/// Move constructor
+GWFrames::PNWaveform::PNWaveform(PNWaveform&& a) :
+  Waveform(std::move(a)), mchi1(std::move(a.mchi1)), mchi2(std::move(a.mchi2)), mOmega_orb(std::move(a.mOmega_orb)),
+  mOmega_prec(std::move(a.mOmega_prec)), mL(std::move(a.mL)), mPhi_orb(std::move(a.mPhi_orb))
+{
+  /// Takes over the data (including history) of the input object,
+  /// which is left empty but valid
+}
+
+/// Assignment operator
+GWFrames::PNWaveform& GWFrames::PNWaveform::operator=(const PNWaveform& a) {
+  Waveform::operator=(a);
+  mchi1 = a.mchi1;
+  mchi2 = a.mchi2;
+  mOmega_orb = a.mOmega_orb;
+  mOmega_prec = a.mOmega_prec;
+  mL = a.mL;
+  mPhi_orb = a.mPhi_orb;
+  return *this;
+}
+
+/// Move assignment operator
+GWFrames::PNWaveform& GWFrames::PNWaveform::operator=(PNWaveform&& a) {
+  Waveform::operator=(std::move(a));
+  mchi1.swap(a.mchi1);
+  mchi2.swap(a.mchi2);
+  mOmega_orb.swap(a.mOmega_orb);
+  mOmega_prec.swap(a.mOmega_prec);
+  mL.swap(a.mL);
+  mPhi_orb.swap(a.mPhi_orb);
+  return *this;
+}
+
 
 /// Constructor of PN waveform from parameters
 GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double delta,
@@ -113,7 +148,9 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history.str("");
     history.clear();
     history << "# Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << std::endl
@@ -156,6 +193,7 @@ GWFrames::PNWaveform::PNWaveform(const std::string& Approximant, const double de
       }
     }
   }
+  UpdateLMIndex();
 
   // Evaluate the waveform data itself, noting that we always use the
   // frame in standard position (BHs on the x axis, with angular
@@ -16,10 +16,13 @@ namespace GWFrames {
   public:  // Constructors and Destructor
     PNWaveform();
     PNWaveform(const PNWaveform& W);
+    PNWaveform(PNWaveform&& W);
     PNWaveform(const std::string& Approximant, const double delta, const std::vector<double>& chi1_i, const std::vector<double>& chi2_i,
                const double Omega_orb_i, double Omega_orb_0=-1.0, const Quaternions::Quaternion& R_frame_i=Quaternions::Quaternion(1,0,0,0),
                const unsigned int MinStepsPerOrbit=32, const double PNWaveformModeOrder=3.5, const double PNOrbitalEvolutionOrder=4.0);
     ~PNWaveform() { }
+    PNWaveform& operator=(const PNWaveform& W);
+    PNWaveform& operator=(PNWaveform&& W);
 
   private:  // Member data
     // std::stringstream history;           // inherited from Waveform
@@ -70,7 +70,7 @@ class Waveform(_Waveform):
     __metaclass__ = _MetaWaveform
 
 _WaveformReturners = ['CopyWithoutData', 'SliceOfTimeIndices', 'SliceOfTimeIndicesWithEll2', 'SliceOfTimeIndicesWithoutModes', 'SliceOfTimes', 'SliceOfTimesWithEll2',
-                      'SliceOfTimesWithoutModes', 'Interpolate', 'InterpolateInPlace', 'DropTimesOutside', 'DropEllModes', 'KeepOnlyEllModes', 'KeepOnlyEll2',
+                      'SliceOfTimesWithoutModes', 'SubsetOfTimeIndices', 'Interpolate', 'InterpolateInPlace', 'InterpolateLocal', 'Compress', 'DropTimesOutside', 'DropEllModes', 'KeepOnlyEllModes', 'KeepOnlyEll2',
                       'SetSpinWeight', 'SetBoostWeight', 'AppendHistory', 'SetHistory', 'SetT', 'SetTime', 'SetFrame', 'SetFrameType', 'SetDataType', 'SetRIsScaledOut',
                       'SetMIsScaledOut', 'SetLM', 'SetData', 'SetData', 'ResizeData', 'Differentiate', 'RotatePhysicalSystem',
                       'RotatePhysicalSystem', 'RotateDecompositionBasis', 'RotateDecompositionBasis', 'TransformToCoprecessingFrame', 'TransformToAngularVelocityFrame',
@@ -174,6 +174,52 @@ def _ObliterateUnderscores(func):
 for _WaveformReturner in _WaveformReturners:
     setattr(Waveform, _WaveformReturner, _ObliterateUnderscores(getattr(Waveform, _WaveformReturner)))
 
+class _MetaHybridizer(type(_Hybridizer)):
+    pass
+
+class Hybridizer(_Hybridizer):
+    """Reusable hybridization of many early Waveforms with one late Waveform.
+
+    Everything in `A.Hybridize(B, t1, t2, tMinStep)` that does not
+    depend on the data of `A` is found once on construction, so that
+    each call to `Hybridize(A)` just fits the spline for `A` and
+    blends.
+
+    Constructor
+    -----------
+    Parameters:
+      B: Late Waveform
+      TA: Times of the early Waveforms to be hybridized
+      t1, t2: Beginning and end of the transition region
+      tMinStep: Minimum time step of the output (default: 0.005)
+
+    """
+    __metaclass__ = _MetaHybridizer
+Hybridizer.Hybridize = _ObliterateUnderscores(_Hybridizer.Hybridize)
+
+def AlignWaveformsBatch(As, Bs, t_1s, t_2s, InitialEvaluations=0, GradientOptimizer=False, FFTScan=False) :
+    """Align many pairs of Waveforms, concurrently.
+
+    The input Waveforms are not changed.  Each pair is copied and
+    aligned as by `AlignWaveforms(A, B, t_1, t_2, InitialEvaluations,
+    [], False, GradientOptimizer, FFTScan)`, with the pairs divided
+    among OpenMP threads.  The GIL is released during the alignment.
+
+    Parameters:
+      As, Bs: Lists of fixed and adjusted Waveforms
+      t_1s, t_2s: Beginning and end of the alignment interval for each pair
+      InitialEvaluations, GradientOptimizer, FFTScan: As in `AlignWaveforms`
+
+    Returns (Statistics, AlignedAs, AlignedBs), three lists.  If
+    aligning pair `i` failed, `Statistics[i].Error` is the error code,
+    and `AlignedAs[i]` and `AlignedBs[i]` should not be used.
+
+    """
+    AlignedAs, AlignedBs = _vectorW(), _vectorW()
+    Statistics = _AlignWaveformsBatch(_vectorW(As), _vectorW(Bs), [float(t) for t in t_1s], [float(t) for t in t_2s],
+                                      AlignedAs, AlignedBs, InitialEvaluations, GradientOptimizer, FFTScan)
+    return list(Statistics), [Waveform(A) for A in AlignedAs], [Waveform(B) for B in AlignedBs]
+
 
 
 
@@ -370,6 +416,151 @@ def ReadFromH5(FileName) :
         f.close()
     return W
 
+def OutputToCompressedH5(W, FileName, Tolerance=1.e-6, FileWriteMode='w') :
+    """
+    Output the Waveform in a compact corotating-frame format.
+
+    The Waveform is transformed to the corotating frame (unless it is
+    already in that frame), where the modes vary slowly.  It is then
+    reduced to a subset of its time steps with `Compress`, and the
+    real and imaginary parts of each mode are quantized to integer
+    multiples of a fixed step and stored as differences between
+    successive values, which gzip compresses very well.  The frame
+    rotors and the original times are stored at full precision.
+
+    Half of the `Tolerance` is allowed for the compression in time and
+    half for the quantization, so that the waveform returned by
+    `ReadFromCompressedH5` differs from the input by approximately
+    `Tolerance` times its peak norm (summed in quadrature over modes)
+    at each of the original times.  This is not a strict bound: the
+    error estimate used by `Compress` for the frame is heuristic, and
+    the spline through the quantized samples can exceed the rounding
+    error between them.
+
+    Note that the FileName is prepended with some descriptive
+    information involving the data type and the frame type, as in
+    `OutputToH5`.
+
+    """
+    import numpy
+    from h5py import File, special_dtype
+    from GWFrames import Inertial, Corotating
+    if(W.FrameType()==Inertial) :
+        W_corot = Waveform(W).TransformToCorotatingFrame()
+    elif(W.FrameType()==Corotating) :
+        W_corot = Waveform(W)
+    else :
+        raise ValueError("OutputToCompressedH5 requires a Waveform in the inertial or corotating frame, not '{0}'.".format(W.FrameTypeString()))
+    W_corot = W_corot.Compress(Tolerance/2.)
+    Data = W_corot.Data()
+    NModes = W_corot.NModes()
+    MaxNorm = numpy.max(numpy.sqrt(numpy.sum(numpy.abs(Data)**2, axis=0)))
+    # Rounding errs by at most Step/2 in each of 2*NModes components
+    Step = (Tolerance*MaxNorm/numpy.sqrt(2*NModes) if MaxNorm>0 else 1.0)
+    # Add descriptive prefix to FileName
+    FileName = __AddFileNamePrefix(W, FileName)
+    # Open the file for output
+    try :
+        F = File(FileName, FileWriteMode)
+    except IOError : # If that did not work...
+        print("OutputToCompressedH5 was unable to open the file '{0}'.\n\n".format(FileName))
+        raise # re-raise the exception after the informative message above
+    try :
+        # Now write all the data to various groups in the file
+        F.attrs['OutputFormatVersion'] = 'GWFrames_CorotatingCompressed_v1'
+        F.create_dataset("History", data = W_corot.HistoryStr() + 'OutputToCompressedH5(W, {0}, {1})\n'.format(FileName, Tolerance))
+        F.create_dataset("Time", data=W_corot.T().tolist(), compression="gzip", shuffle=True)
+        F.create_dataset("OriginalTime", data=W.T().tolist(), compression="gzip", shuffle=True)
+        if(len(W.VersionHist())>0) :
+            F.create_dataset("VersionHist", (1,2), data = W.VersionHist(), dtype=special_dtype(vlen=bytes))
+        F.create_dataset("Frame", data=[[r[0], r[1], r[2], r[3]] for r in W_corot.Frame()], compression="gzip", shuffle=True)
+        F.attrs['FrameType'] = W.FrameType()
+        F.attrs['DataType'] = W.DataType()
+        F.attrs['RIsScaledOut'] = int(W.RIsScaledOut())
+        F.attrs['MIsScaledOut'] = int(W.MIsScaledOut())
+        F.attrs['Tolerance'] = Tolerance
+        F.attrs['QuantizationStep'] = Step
+        Group = F.create_group("Data")
+        for i_m in range(NModes) :
+            ell,m = W_corot.LM()[i_m]
+            Quantized = numpy.rint(numpy.array([Data[i_m].real, Data[i_m].imag])/Step).astype('int64')
+            Differences = numpy.concatenate((Quantized[:,:1], numpy.diff(Quantized, axis=1)), axis=1)
+            Data_m = Group.create_dataset("l{0}_m{1:+}".format(int(ell), int(m)), data=Differences,
+                                          compression="gzip", shuffle=True)
+            Data_m.attrs['ell'] = ell
+            Data_m.attrs['m'] = m
+    finally : # Use `finally` to make sure this happens:
+        # Close the file and we are done
+        F.close()
+Waveform.OutputToCompressedH5 = OutputToCompressedH5
+PNWaveform.OutputToCompressedH5 = OutputToCompressedH5
+
+def ReadFromCompressedH5(FileName, OriginalTimes=True, OriginalFrame=True) :
+    """
+    Read data from an H5 file, as output by `OutputToCompressedH5`.
+
+    By default, the Waveform is interpolated back to the times of the
+    Waveform that was written, and transformed back to that
+    Waveform's frame.  If `OriginalTimes` is False, the Waveform is
+    returned at the (fewer) stored times; if `OriginalFrame` is False,
+    it is returned in the corotating frame.  Doing neither is the
+    cheapest way to get at the data.
+    """
+    from h5py import File
+    from GWFrames import Inertial, Corotating
+    from Quaternions import Quaternion
+    import numpy
+    try :
+        f = File(FileName, 'r')
+    except IOError :
+        print("ReadFromCompressedH5 could not open the file '{0}'\n\n".format(FileName))
+        raise
+    try :
+        # Initialize the Waveform object
+        W = Waveform()
+        # Record the filename being read in
+        W.AppendHistory(str("*this = GWFrames.ReadFromCompressedH5(FileName='{0}')\n".format(FileName)))
+        # Add the old history to the new history
+        W.AppendHistory(str("# <previous_history>\n#" + f['History'][()].replace('\n','\n#') + "# </previous_history>\n"))
+        # Get the time and frame data
+        W.SetTime(f['Time'])
+        W.SetFrame([Quaternion(r) for r in f['Frame']])
+        OriginalTime = f['OriginalTime'][:]
+        OriginalFrameType = int(f.attrs['FrameType'])
+        # Get the descriptive items
+        W.SetFrameType(Corotating)
+        W.SetDataType(int(f.attrs['DataType']))
+        W.SetRIsScaledOut(bool(f.attrs['RIsScaledOut']))
+        W.SetMIsScaledOut(bool(f.attrs['MIsScaledOut']))
+        Step = float(f.attrs['QuantizationStep'])
+        # Get list of data sets and the LM data (unsorted)
+        ModeData = list(f['Data'])
+        LMlist = [[f['Data'][Data_m].attrs['ell'], f['Data'][Data_m].attrs['m']] for Data_m in ModeData]
+        NModes = len(LMlist)
+        # Get the order of the sort by LM
+        SortedIndices = sorted(range(NModes),key=lambda i : LMlist[i])
+        # Initialize the data set and LM set
+        Data = numpy.empty((NModes, W.NTimes()), dtype='complex128')
+        LM = numpy.empty((NModes, 2), dtype='int')
+        # Loop through the modes, undoing the differences and quantization
+        for i_m in range(NModes) :
+            Quantized = numpy.cumsum(f['Data'][ModeData[SortedIndices[i_m]]][:], axis=1)
+            Data[i_m] = Step*(Quantized[0] + 1j*Quantized[1])
+            LM[i_m] = LMlist[SortedIndices[i_m]]
+        # Now add these data to the Waveform object
+        W.SetLM(LM.tolist())
+        W.SetData(Data)
+    except KeyError :
+        print("This H5 file appears to have not stored all the required information.\n\n")
+        raise # Re-raise the exception after adding our information
+    finally : # Use `finally` to make sure this happens:
+        f.close()
+    if(OriginalTimes) :
+        W = W.Interpolate(OriginalTime)
+    if(OriginalFrame and OriginalFrameType==Inertial) :
+        W.TransformToInertialFrame()
+    return W
+
 def MonotonicIndices(T, MinTimeStep=1.e-5) :
     """
     Given an array of times, return the indices that make the array strictly monotonic.
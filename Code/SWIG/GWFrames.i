@@ -29,6 +29,7 @@
   #include "../Waveforms.hpp"
   #include "../PNWaveforms.hpp"
   #include "../WaveformsAtAPointFT.hpp"
+  #include "../fft.hpp"
 
 %}
 
@@ -97,6 +98,7 @@
 //// Finally, include the descriptions of the actual C++ code in this module ////
 /////////////////////////////////////////////////////////////////////////////////
 %include "Utilities.i"
+%include "fft.i"
 %include "Scri.i"
 %include "Waveforms.i"
 %include "PNWaveforms.i"
@@ -7,6 +7,8 @@
 //// Ignore things that don't translate well...
 // %ignore operator<<;
 // %ignore GWFrames::Waveform::operator=;
+%ignore GWFrames::PNWaveform::operator=;
+%ignore GWFrames::PNWaveform::PNWaveform(PNWaveform&&);
 //// These will convert the output data to numpy.ndarray for easier use
 #ifndef SWIGPYTHON_BUILTIN
 %feature("pythonappend") GWFrames::PNWaveform::chi1() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
@@ -8,7 +8,13 @@
 %ignore GWFrames::operator*;
 %ignore GWFrames::operator/;
 %ignore GWFrames::abs;
+%ignore GWFrames::MatrixC::MatrixC(MatrixC&&);
+%ignore GWFrames::MatrixC::operator=;
+%ignore GWFrames::MatrixC::View;
+%ignore GWFrames::MatrixC::Adopt;
 %ignore GWFrames::pow;
+%ignore GWFrames::ComplexDerivative(const std::complex<double>*, const double*, const unsigned int, const unsigned int, const unsigned int, std::complex<double>*);
+%ignore GWFrames::ComplexMatrixProduct;
 %include "../Utilities.hpp"
 namespace std {
   %template(_vectorM) vector<GWFrames::Matrix>;
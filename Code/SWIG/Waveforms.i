@@ -8,10 +8,17 @@
 // (which are defined in Extensions.py using GWFrames::_Waveform as a
 // metaclass).
 %rename(_Waveform) Waveform;
+// Likewise, Hybridizer is extended in Extensions.py so that
+// `Hybridize` returns a GWFrames.Waveform
+%rename(_Hybridizer) Hybridizer;
+// AlignWaveformsBatch is wrapped in Extensions.py to take and return
+// python lists of GWFrames.Waveform
+%rename(_AlignWaveformsBatch) AlignWaveformsBatch;
 
 //// Ignore things that don't translate well...
 %ignore operator<<;
 %ignore GWFrames::Waveform::operator=;
+%ignore GWFrames::Waveform::Waveform(Waveform&&);
 %ignore GWFrames::Waveforms::operator[];
 %rename(__getitem__) GWFrames::Waveforms::operator[] const;
 
@@ -35,16 +42,46 @@
 %feature("pythonappend") GWFrames::Waveform::CorotatingFrame() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 %feature("pythonappend") GWFrames::Waveform::PNEquivalentOrbitalAV() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 %feature("pythonappend") GWFrames::Waveform::PNEquivalentPrecessionalAV() const %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") GWFrames::Waveform::EvaluateAtPoints %{ if isinstance(val, tuple) : val = numpy.array(val) %}
 #endif
 
 %apply double& OUTPUT { double& deltat };
 
+//// Release the GIL while aligning a batch, so that other python
+//// threads can run; the GIL is re-acquired before any error is set
+%exception GWFrames::AlignWaveformsBatch {
+  PyThreadState* volatile _save = 0;
+  if (!sigsetjmp(GWFrames::FloatingPointExceptionJumpBuffer, 1)) {
+    try {
+      _save = PyEval_SaveThread();
+      $action;
+      PyEval_RestoreThread(_save);
+    } catch(int i) {
+      PyEval_RestoreThread(_save);
+      std::stringstream s;
+      if(i>-1 && i<GWFramesNumberOfErrors) { s << "$fulldecl: " << GWFramesErrors[i]; }
+      else  { s << "$fulldecl: Unknown exception number {" << i << "}"; }
+      PyErr_SetString(GWFramesExceptions[i], s.str().c_str());
+      return 0;
+    } catch(...) {
+      PyEval_RestoreThread(_save);
+      PyErr_SetString(PyExc_RuntimeError, "$fulldecl: Unknown exception; default handler");
+      return 0;
+    }
+  } else {
+    if(_save) { PyEval_RestoreThread(_save); }
+    PyErr_SetString(PyExc_RuntimeError, "$fulldecl: Caught a floating-point exception in the c++ code.");
+    return 0;
+  }
+}
+
 //// Parse the header file to generate wrappers
 %include "../Waveforms.hpp"
 
-//// Make sure vectors of Waveform are understood
+//// Make sure vectors of Waveform (and of alignment statistics) are understood
 namespace std {
   %template(_vectorW) vector<GWFrames::Waveform>;
+  %template(_vectorAlignWaveformsStatistics) vector<GWFrames::AlignWaveformsStatistics>;
 };
 
 //// Make any additions to the Waveform class here
@@ -107,4 +144,8 @@ namespace std {
 %apply double *INOUT { double& timeOffset };
 %apply double *INOUT { double& phaseOffset };
 %apply double *INOUT { double& match };
+#ifndef SWIGPYTHON_BUILTIN
+%feature("pythonappend") GWFrames::MatchBank::Matches %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") GWFrames::MatchBank::MatchMatrix %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+#endif
 %include "../WaveformsAtAPointFT.hpp"
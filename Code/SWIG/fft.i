@@ -0,0 +1,42 @@
+//////////////////////////////
+//// Import FFT utilities ////
+//////////////////////////////
+
+//// The transforms act in place in c++, which doesn't translate well
+//// to python, so the wrappers below return transformed copies instead
+%ignore WaveformUtilities::WrapVecDoub;
+%ignore WaveformUtilities::dft;
+%ignore WaveformUtilities::idft;
+%ignore WaveformUtilities::realdft;
+%ignore WaveformUtilities::MakeFFTWPlannerThreadSafe;
+
+//// These will convert the output data to numpy.ndarray for easier use
+#ifndef SWIGPYTHON_BUILTIN
+%feature("pythonappend") WaveformUtilities::TimeToFrequency %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::TimeToPositiveFrequencies %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::rdft %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::irdft %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::convlv %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::DFT %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::IDFT %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::DFTInterleaved %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::IDFTInterleaved %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+%feature("pythonappend") WaveformUtilities::RealDFT %{ if isinstance(val, tuple) : val = numpy.array(val) %}
+#endif
+
+%include "../fft.hpp"
+
+%inline %{
+  namespace WaveformUtilities {
+    /// Bare forward FFT sum of complex data
+    std::vector<std::complex<double> > DFT(std::vector<std::complex<double> > data) { dft(data); return data; }
+    /// Bare backward FFT sum of complex data
+    std::vector<std::complex<double> > IDFT(std::vector<std::complex<double> > data) { idft(data); return data; }
+    /// Bare forward FFT sum of complex data stored as interleaved real and imaginary parts
+    std::vector<double> DFTInterleaved(std::vector<double> data) { dft(data); return data; }
+    /// Bare backward FFT sum of complex data stored as interleaved real and imaginary parts
+    std::vector<double> IDFTInterleaved(std::vector<double> data) { idft(data); return data; }
+    /// Forward FFT of real data, in the packed format of Numerical Recipes' `realft`
+    std::vector<double> RealDFT(std::vector<double> data) { realdft(data); return data; }
+  }
+%}
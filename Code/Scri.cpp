@@ -882,25 +882,33 @@ Scri::Scri(const GWFrames::Waveform& psi0, const GWFrames::Waveform& psi1,
     throw(GWFrames_VectorSizeMismatch);
   }
 
+  // Find the index of each (ell,m) mode in each input Waveform
+  const GWFrames::Waveform* Inputs[6] = { &psi0, &psi1, &psi2, &psi3, &psi4, &sigma };
+  const int nellm = (ellMax+1)*(ellMax+1);
+  std::vector<std::vector<unsigned int> > Indices(6, std::vector<unsigned int>(nellm));
+  for(unsigned int i_W=0; i_W<6; ++i_W) {
+    for(int i_ellm=0, ell=0; ell<=ellMax; ++ell) {
+      for(int m=-ell; m<=ell; ++m, ++i_ellm) {
+        Indices[i_W][i_ellm] = Inputs[i_W]->FindModeIndex(ell,m);
+      }
+    }
+  }
+
   // Fill the new data
   const unsigned int ntimes = t.size();
   for(unsigned int i_t=0; i_t<ntimes; ++i_t) { // Fill everything but sigmadot
     GWFrames::SliceModes& slice = slices[i_t];
-    int i_ellm=0;
-    for(int ell=0; ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_ellm) {
-        slice[0][i_ellm] = psi0.Data(psi0.FindModeIndex(ell,m), i_t);
-        slice[1][i_ellm] = psi1.Data(psi1.FindModeIndex(ell,m), i_t);
-        slice[2][i_ellm] = psi2.Data(psi2.FindModeIndex(ell,m), i_t);
-        slice[3][i_ellm] = psi3.Data(psi3.FindModeIndex(ell,m), i_t);
-        slice[4][i_ellm] = psi4.Data(psi4.FindModeIndex(ell,m), i_t);
-        slice[5][i_ellm] = sigma.Data(sigma.FindModeIndex(ell,m), i_t);
+    for(unsigned int i_W=0; i_W<6; ++i_W) {
+      const GWFrames::Waveform& W = *Inputs[i_W];
+      const std::vector<unsigned int>& Indices_W = Indices[i_W];
+      for(int i_ellm=0; i_ellm<nellm; ++i_ellm) {
+        slice[i_W][i_ellm] = W.Data(Indices_W[i_ellm], i_t);
       }
     }
   }
   for(int i_ellm=0, ell=0; ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m, ++i_ellm) {
-      const std::vector<std::complex<double> > sigmadot = sigma.DataDot(sigma.FindModeIndex(ell,m));
+      const std::vector<std::complex<double> > sigmadot = sigma.DataDot(Indices[5][i_ellm]);
       for(unsigned int i_t=0; i_t<ntimes; ++i_t) { // Fill sigmadot
         slices[i_t][6][i_ellm] = sigmadot[i_t];
       }
@@ -3,11 +3,16 @@
 
 #include <iostream>
 #include <cmath>
+#include <cstdlib>
+#include <algorithm>
 #include "Utilities.hpp"
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_eigen.h>
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_cblas.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "Quaternions.hpp"
 #include "Errors.hpp"
 using GWFrames::Matrix;
@@ -27,6 +32,46 @@ using std::endl;
 const std::complex<double> ComplexI(0.0, 1.0);
 
 
+#if defined(_OPENMP) && !defined(DOXYGEN)
+namespace {
+  // The OpenMP runtime's choice when this library is loaded (usually
+  // the number of cores, or OMP_NUM_THREADS), restored by SetNumThreads(0)
+  const int DefaultNumThreads = omp_get_max_threads();
+}
+#endif
+
+/// Set the number of threads used by the time-parallel loops
+void GWFrames::SetNumThreads(const int N) {
+  ///
+  /// \param N Number of threads; values less than 1 select the default
+  ///
+  /// The default is whatever the OpenMP runtime chose when GWFrames was
+  /// loaded (usually the number of cores, or the value of the
+  /// OMP_NUM_THREADS environment variable).  If the code was compiled
+  /// without OpenMP support, this function has no effect.
+  #ifdef _OPENMP
+  if(N<1) {
+    omp_set_num_threads(DefaultNumThreads);
+  } else {
+    omp_set_num_threads(N);
+  }
+  #else
+  if(N>1) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Warning: GWFrames was compiled without OpenMP;"
+              << " ignoring request for " << N << " threads." << std::endl;
+  }
+  #endif
+}
+
+/// Number of threads used by the time-parallel loops
+int GWFrames::NumThreads() {
+  #ifdef _OPENMP
+  return omp_get_max_threads();
+  #else
+  return 1;
+  #endif
+}
+
 double GWFrames::abs(const std::vector<double>& v) {
   double n=0.0;
   for(unsigned int i=0; i<v.size(); ++i) {
@@ -467,35 +512,62 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
   if(f.size()<2) { cerr << "\n" << __FILE__ << ":" << __LINE__ << ": size=" << f.size() << endl; throw(GWFrames_NotEnoughPointsForDerivative); }
 
   vector<std::complex<double> > D(f.size());
-  const unsigned int i_f = f.size()-1;
-
-  if(f.size()==2) {
-    D[0] = (f[1]-f[0])/(t[1]-t[0]);
-    D[1] = D[0];
-    return D;
-  }
+  ComplexDerivative(&f[0], &t[0], f.size(), 0, f.size(), &D[0]);
+  return D;
+}
 
-  if(f.size()==3 || f.size()==4) {
-    double hprev = t[1]-t[0];
-    { // Compute first point
-      const double hnext = t[2]-t[1];
-      D[0] = -((2*hprev+hnext)/(hprev*(hprev+hnext)))*f[0] + ((hnext+hprev)/(hnext*hprev))*f[1] - (hprev/(hnext*(hnext+hprev)))*f[2];
-    }
-    for(unsigned int i=1; i<i_f; ++i) { // Compute intermediate points
-      const double hnext = t[i+1]-t[i];
-      /// Sundqvist and Veronis, Tellus XXII (1970), 1
-      D[i] = (f[i+1] - f[i-1]*SQR(hnext/hprev) - f[i]*(1-SQR(hnext/hprev))) / (hnext*(1+hnext/hprev));
-      hprev = hnext;
-    }
-    { // Compute final point
-      const double hnext = t[i_f]  -t[i_f-1];
-      const double hprev = t[i_f-1]-t[i_f-2];
-      D[i_f] = (hnext/(hprev*(hprev+hnext)))*f[i_f-2] - ((hnext+hprev)/(hnext*hprev))*f[i_f-1] + ((hprev+2*hnext)/(hnext*(hnext+hprev)))*f[i_f];
+/// Differentiate complex data at a range of indices
+void GWFrames::ComplexDerivative(const std::complex<double>* f, const double* t, const unsigned int N,
+                                 const unsigned int i_a, const unsigned int i_b, std::complex<double>* D) {
+  ///
+  /// \param f Array of N std::complex<double>s.
+  /// \param t Array of N corresponding time steps.
+  /// \param N Length of f and t.
+  /// \param i_a First index at which to evaluate the derivative.
+  /// \param i_b One past the last index at which to evaluate the derivative.
+  /// \param D Output array of length i_b-i_a.
+  ///
+  /// This gives exactly the values of the vector version at indices
+  /// [i_a, i_b), but only reads f and t within two points of that
+  /// range (or the first or last five points), so it can be used on
+  /// blocks of a long time series.
+
+  if(N<2) { cerr << "\n" << __FILE__ << ":" << __LINE__ << ": size=" << N << endl; throw(GWFrames_NotEnoughPointsForDerivative); }
+  if(i_a>i_b || i_b>N) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": [i_a,i_b)=[" << i_a << "," << i_b << ") is not within [0," << N << ")" << endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  const unsigned int i_f = N-1;
+
+  if(N<5) {
+    // Too short for blocks to matter; just do the whole thing
+    vector<std::complex<double> > DAll(N);
+    if(N==2) {
+      DAll[0] = (f[1]-f[0])/(t[1]-t[0]);
+      DAll[1] = DAll[0];
+    } else { // N==3 or N==4
+      double hprev = t[1]-t[0];
+      { // Compute first point
+        const double hnext = t[2]-t[1];
+        DAll[0] = -((2*hprev+hnext)/(hprev*(hprev+hnext)))*f[0] + ((hnext+hprev)/(hnext*hprev))*f[1] - (hprev/(hnext*(hnext+hprev)))*f[2];
+      }
+      for(unsigned int i=1; i<i_f; ++i) { // Compute intermediate points
+        const double hnext = t[i+1]-t[i];
+        /// Sundqvist and Veronis, Tellus XXII (1970), 1
+        DAll[i] = (f[i+1] - f[i-1]*SQR(hnext/hprev) - f[i]*(1-SQR(hnext/hprev))) / (hnext*(1+hnext/hprev));
+        hprev = hnext;
+      }
+      { // Compute final point
+        const double hnext = t[i_f]  -t[i_f-1];
+        const double hprev = t[i_f-1]-t[i_f-2];
+        DAll[i_f] = (hnext/(hprev*(hprev+hnext)))*f[i_f-2] - ((hnext+hprev)/(hnext*hprev))*f[i_f-1] + ((hprev+2*hnext)/(hnext*(hnext+hprev)))*f[i_f];
+      }
     }
-    return D;
+    std::copy(DAll.begin()+i_a, DAll.begin()+i_b, D);
+    return;
   }
 
-  for(unsigned int i=0; i<2; ++i) {
+  for(unsigned int i=i_a; i<std::min(2u,i_b); ++i) {
     const double x = t[i];
     const std::complex<double>& f1 = f[0];
     const std::complex<double>& f2 = f[1];
@@ -522,14 +594,14 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
     const double h34 = x3 - x4;
     const double h35 = x3 - x5;
     const double h45 = x4 - x5;
-    D[i] =
+    D[i-i_a] =
       (-(h2*h3*h4 +h2*h3*h5 +h2*h4*h5 +h3*h4*h5)*f1/((h12)*(h13)*(h14)*(h15))
        +(h1*h3*h4 + h1*h3*h5 + h1*h4*h5 + h3*h4*h5)*f2/((h12)*(h23)*(h24)*(h25))
        -(h1*h2*h4 + h1*h2*h5 + h1*h4*h5 + h2*h4*h5)*f3/((h13)*(h23)*(h34)*(h35))
        +(h1*h2*h3 + h1*h2*h5 + h1*h3*h5 + h2*h3*h5)*f4/((h14)*(h24)*(h34)*(h45))
        -(h1*h2*h3 + h1*h2*h4 + h1*h3*h4 + h2*h3*h4)*f5/((h15)*(h25)*(h35)*(h45)));
   }
-  for(unsigned int i=2; i<i_f-1; ++i) {
+  for(unsigned int i=std::max(2u,i_a); i<std::min(i_f-1,i_b); ++i) {
     const std::complex<double>& f1 = f[i-2];
     const std::complex<double>& f2 = f[i-1];
     const std::complex<double>& f3 = f[i];
@@ -554,14 +626,14 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
     const double h34 = x3 - x4;
     const double h35 = x3 - x5;
     const double h45 = x4 - x5;
-    D[i] =
+    D[i-i_a] =
       (-(h2*h4*h5)*f1/(h12*h13*h14*h15)
        +(h1*h4*h5)*f2/(h12*h23*h24*h25)
        -(h1*h2*h4 + h1*h2*h5 + h1*h4*h5 + h2*h4*h5)*f3/((h13)*(h23)*(h34)*(h35))
        +(h1*h2*h5)*f4/(h14*h24*h34*h45)
        -(h1*h2*h4)*f5/(h15*h25*h35*h45));
   }
-  for(unsigned int i=i_f-1; i<i_f+1; ++i) {
+  for(unsigned int i=std::max(i_f-1,i_a); i<i_b; ++i) {
     const double x = t[i];
     const std::complex<double>& f1 = f[i_f-4];
     const std::complex<double>& f2 = f[i_f-3];
@@ -588,15 +660,14 @@ std::vector<std::complex<double> > GWFrames::ComplexDerivative(const std::vector
     const double h34 = x3 - x4;
     const double h35 = x3 - x5;
     const double h45 = x4 - x5;
-    D[i] =
+    D[i-i_a] =
       (-(h2*h3*h4 +h2*h3*h5 +h2*h4*h5 +h3*h4*h5)*f1/((h12)*(h13)*(h14)*(h15))
        +(h1*h3*h4 + h1*h3*h5 + h1*h4*h5 + h3*h4*h5)*f2/((h12)*(h23)*(h24)*(h25))
        -(h1*h2*h4 + h1*h2*h5 + h1*h4*h5 + h2*h4*h5)*f3/((h13)*(h23)*(h34)*(h35))
        +(h1*h2*h3 + h1*h2*h5 + h1*h3*h5 + h2*h3*h5)*f4/((h14)*(h24)*(h34)*(h45))
        -(h1*h2*h3 + h1*h2*h4 + h1*h3*h4 + h2*h3*h4)*f5/((h15)*(h25)*(h35)*(h45)));
   }
-  return D;
-
+  return;
 }
 
 
@@ -1069,129 +1140,272 @@ double GWFrames::Determinant(Matrix& M) {
 
 ////////////////////////////////////////////////////////////////
 
+// The storage of a MatrixC is a single block, aligned to this many
+// bytes (a cache line, and the widest SIMD register), with the rows
+// stored one after another.
+static const std::size_t MatrixCAlignment = 64;
+
+static void MatrixCFree(void* p) { free(p); }
+
+/// Allocate new (zeroed) storage of size n x m, releasing any old storage
+void MatrixC::allocate(int n, int m) {
+  nn = n;
+  mm = m;
+  ld = m;
+  v = NULL;
+  owner.reset();
+  const std::size_t nel = std::size_t(n>0 ? n : 0)*std::size_t(m>0 ? m : 0);
+  if(nel>0) {
+    void* p = NULL;
+    if(posix_memalign(&p, MatrixCAlignment, nel*sizeof(std::complex<double>)) != 0) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed to allocate " << n << "x" << m << " complex matrix." << std::endl;
+      throw(GWFrames_FailedSystemCall);
+    }
+    v = static_cast<std::complex<double>*>(p);
+    owner = std::shared_ptr<void>(p, MatrixCFree);
+    std::fill(v, v+nel, std::complex<double>(0.0, 0.0));
+  }
+}
+
+/// True if the storage is a contiguous block allocated by this matrix and shared with no other
+bool MatrixC::exclusive() const {
+  /// Views, adopted buffers, and blocks shared with another matrix
+  /// are never written by assignment, resizing, or `assign`; those
+  /// allocate new storage instead.
+  void (*const* deleter)(void*) = std::get_deleter<void(*)(void*)>(owner);
+  return deleter && *deleter==&MatrixCFree && owner.use_count()==1 && v==owner.get() && ld==mm;
+}
+
 MatrixC::MatrixC()
-  : nn(0), mm(0), v(NULL)
+  : nn(0), mm(0), ld(0), v(NULL), owner()
 { }
 
 MatrixC::MatrixC(int n, int m)
-  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL)
+  : nn(0), mm(0), ld(0), v(NULL), owner()
 {
-  const int nel=m*n;
-  if(v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
-  for(int i=1;i<n;i++) {
-    v[i] = v[i-1] + m;
-  }
+  allocate(n, m);
 }
 
 MatrixC::MatrixC(int n, int m, const std::complex<double> &a)
-  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL)
+  : nn(0), mm(0), ld(0), v(NULL), owner()
 {
-  const int nel=m*n;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
-  for (int i=1; i< n; i++) v[i] = v[i-1] + m;
-  for (int i=0; i< n; i++) for (int j=0; j<m; j++) v[i][j] = a;
+  allocate(n, m);
+  std::fill(v, v+std::size_t(nn)*mm, a);
 }
 
 MatrixC::MatrixC(int n, int m, const std::complex<double> *a)
-  : nn(n), mm(m), v(n>0 ? new std::complex<double>*[n] : NULL)
+  : nn(0), mm(0), ld(0), v(NULL), owner()
 {
-  const int nel=m*n;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
-  for (int i=1; i<n; i++) v[i] = v[i-1] + m;
-  for (int i=0; i<n; i++) for (int j=0; j<m; j++) v[i][j] = *a++;
+  allocate(n, m);
+  std::copy(a, a+std::size_t(nn)*mm, v);
 }
 
 MatrixC::MatrixC(const MatrixC &rhs)
-  : nn(rhs.nn), mm(rhs.mm), v(nn>0 ? new std::complex<double>*[nn] : NULL)
+  : nn(0), mm(0), ld(0), v(NULL), owner()
 {
-  const int nel=mm*nn;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
-  for (int i=1; i<nn; i++) v[i] = v[i-1] + mm;
-  for (int i=0; i<nn; i++) for (int j=0; j<mm; j++) v[i][j] = rhs[i][j];
+  /// Note that copying a view produces a new matrix with its own
+  /// storage.
+  allocate(rhs.nn, rhs.mm);
+  for (int i=0; i<nn; i++) std::copy(rhs[i], rhs[i]+mm, (*this)[i]);
+}
+
+MatrixC::MatrixC(MatrixC &&rhs)
+  : nn(rhs.nn), mm(rhs.mm), ld(rhs.ld), v(rhs.v), owner(std::move(rhs.owner))
+{
+  rhs.nn = 0;
+  rhs.mm = 0;
+  rhs.ld = 0;
+  rhs.v = NULL;
 }
 
 MatrixC::MatrixC(const std::vector<std::vector<std::complex<double> > >& rhs)
-  : nn(rhs.size()), mm(nn>0 ? rhs[0].size() : 0), v(nn>0 ? new std::complex<double>*[nn] : NULL)
+  : nn(0), mm(0), ld(0), v(NULL), owner()
 {
-  const int nel=mm*nn;
-  if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
-  for (int i=1; i<nn; i++) v[i] = v[i-1] + mm;
-  for (int i=0; i<nn; i++) for (int j=0; j<mm; j++) v[i][j] = rhs[i][j];
+  allocate(rhs.size(), rhs.size()>0 ? rhs[0].size() : 0);
+  for (int i=0; i<nn; i++) std::copy(rhs[i].begin(), rhs[i].begin()+mm, (*this)[i]);
 }
 
 MatrixC & MatrixC::operator=(const MatrixC &rhs) {
+  /// The existing storage is reused only if the shapes match and
+  /// this matrix is the sole owner of its own block.  Assigning to a
+  /// `View` or `Adopt`ed matrix detaches it from the caller's buffer,
+  /// which is never written.
   if (this != &rhs) {
-    if (nn != rhs.nn || mm != rhs.mm) {
-      if (v != NULL) {
-        delete[] (v[0]);
-        delete[] (v);
-      }
-      nn=rhs.nn;
-      mm=rhs.mm;
-      v = nn>0 ? new std::complex<double>*[nn] : NULL;
-      const int nel = mm*nn;
-      if (v) v[0] = nel>0 ? new std::complex<double>[nel] : NULL;
-      for (int i=1; i< nn; i++) v[i] = v[i-1] + mm;
+    if (nn != rhs.nn || mm != rhs.mm || !exclusive()) {
+      allocate(rhs.nn, rhs.mm);
     }
-    for (int i=0; i<nn; i++) for (int j=0; j<mm; j++) v[i][j] = rhs[i][j];
+    for (int i=0; i<nn; i++) std::copy(rhs[i], rhs[i]+mm, (*this)[i]);
+  }
+  return *this;
+}
+
+MatrixC & MatrixC::operator=(MatrixC &&rhs) {
+  if (this != &rhs) {
+    nn = rhs.nn;
+    mm = rhs.mm;
+    ld = rhs.ld;
+    v = rhs.v;
+    owner = std::move(rhs.owner);
+    rhs.nn = 0;
+    rhs.mm = 0;
+    rhs.ld = 0;
+    rhs.v = NULL;
+    rhs.owner.reset();
   }
   return *this;
 }
 
 void MatrixC::swap(MatrixC& b) {
-  { const int n = b.nn; b.nn=nn; nn=n; }
-  { const int m = b.mm; b.mm=mm; mm=m; }
-  { std::complex<double>** vv=b.v; b.v=v; v=vv; }
+  std::swap(nn, b.nn);
+  std::swap(mm, b.mm);
+  std::swap(ld, b.ld);
+  std::swap(v, b.v);
+  owner.swap(b.owner);
   return;
 }
 
+/// Wrap caller-owned memory without copying
+MatrixC MatrixC::View(int n, int m, std::complex<double>* a, int LeadingDimension) {
+  ///
+  /// \param n Number of rows
+  /// \param m Number of columns
+  /// \param a Pointer to the first element of the first row
+  /// \param LeadingDimension Distance between the starts of consecutive rows [default: m]
+  ///
+  /// The caller is responsible for keeping the memory alive for as
+  /// long as the returned object (or any copy of it made by moving)
+  /// is in use.
+  MatrixC M;
+  M.nn = n;
+  M.mm = m;
+  M.ld = (LeadingDimension<0 ? m : LeadingDimension);
+  M.v = a;
+  return M;
+}
+
+/// Take shared ownership of externally allocated memory without copying
+MatrixC MatrixC::Adopt(int n, int m, std::complex<double>* a, const std::shared_ptr<void>& Owner, int LeadingDimension) {
+  ///
+  /// \param n Number of rows
+  /// \param m Number of columns
+  /// \param a Pointer to the first element of the first row
+  /// \param Owner Handle whose deleter releases the memory (e.g., a mmap region or numpy buffer)
+  /// \param LeadingDimension Distance between the starts of consecutive rows [default: m]
+  MatrixC M = View(n, m, a, LeadingDimension);
+  M.owner = Owner;
+  return M;
+}
+
 // / \@cond
 void MatrixC::resize(int newn, int newm) {
-  if (newn != nn || newm != mm) {
-    if (v != NULL) {
-      delete[] (v[0]);
-      delete[] (v);
-    }
-    nn = newn;
-    mm = newm;
-    v = nn>0 ? new std::complex<double>*[nn] : NULL;
-    const int nel = mm*nn;
-    if (v) { v[0] = nel>0 ? new std::complex<double>[nel] : NULL; }
-    for(int i=1; i< nn; i++) {
-      v[i] = v[i-1] + mm;
-    }
+  if (newn != nn || newm != mm || !exclusive()) {
+    allocate(newn, newm);
   }
 }
 // / \@endcond
 
 void MatrixC::assign(int newn, int newm, const std::complex<double>& a) {
-  if (newn != nn || newm != mm) {
-    if (v != NULL) {
-      delete[] (v[0]);
-      delete[] (v);
-    }
-    nn = newn;
-    mm = newm;
-    v = nn>0 ? new std::complex<double>*[nn] : NULL;
-    const int nel = mm*nn;
-    if(v) { v[0] = nel>0 ? new std::complex<double>[nel] : NULL; }
-    for(int i=1; i< nn; i++) {
-      v[i] = v[i-1] + mm;
-    }
+  if (newn != nn || newm != mm || !exclusive()) {
+    allocate(newn, newm);
   }
   for(int i=0; i< nn; i++) {
-    for(int j=0; j<mm; j++) {
-      v[i][j] = a;
-    }
+    std::fill((*this)[i], (*this)[i]+mm, a);
   }
 }
 
 MatrixC::~MatrixC()
-{
-  if (v != NULL) {
-    delete[] (v[0]);
-    delete[] (v);
+{ }
+
+/// Dense complex matrix product C = A B, with row-major storage
+void GWFrames::ComplexMatrixProduct(const int M, const int N, const int K,
+                                    const std::complex<double>* A, const int lda,
+                                    const std::complex<double>* B, const int ldb,
+                                    std::complex<double>* C, const int ldc) {
+  ///
+  /// \param M Number of rows of A and C
+  /// \param N Number of columns of B and C
+  /// \param K Number of columns of A and rows of B
+  /// \param A Pointer to the first element of A
+  /// \param lda Distance between the starts of consecutive rows of A
+  /// \param B Pointer to the first element of B
+  /// \param ldb Distance between the starts of consecutive rows of B
+  /// \param C Pointer to the first element of C, which is overwritten
+  /// \param ldc Distance between the starts of consecutive rows of C
+  ///
+  /// If the code is compiled with `USE_CBLAS`, this simply calls
+  /// `cblas_zgemm`, so that an optimized BLAS can be linked in place
+  /// of GSL's reference CBLAS.  (Both the Makefile and setup.py
+  /// define `USE_CBLAS` when the environment variable `GWFRAMES_BLAS`
+  /// is set to the names of the libraries to link, without `-l`;
+  /// e.g., `GWFRAMES_BLAS=openblas`.)  Otherwise, B is copied one panel of
+  /// columns at a time into separate real and imaginary arrays small
+  /// enough to stay in cache, and a few rows of C are accumulated at
+  /// once from each row of the panel, so that each value loaded from
+  /// B is used several times in unit-stride loops the compiler can
+  /// vectorize.  The panels are independent, so they are shared
+  /// among threads.
+  ///
+  if(M<=0 || N<=0) { return; }
+  if(K<=0) {
+    for(int i=0; i<M; ++i) {
+      std::fill(C+std::ptrdiff_t(i)*ldc, C+std::ptrdiff_t(i)*ldc+N, complex<double>(0.0, 0.0));
+    }
+    return;
+  }
+#ifdef USE_CBLAS
+  const complex<double> One(1.0, 0.0), Zero(0.0, 0.0);
+  cblas_zgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, &One, A, lda, B, ldb, &Zero, C, ldc);
+#else
+  const int ColumnBlock = 128;
+  const int RowBlock = 4;
+  const int NBlocks = (N+ColumnBlock-1)/ColumnBlock;
+  #pragma omp parallel if(NBlocks>1 && double(M)*double(N)*double(K)>1.0e6)
+  {
+    vector<double> Bre(std::size_t(K)*ColumnBlock), Bim(std::size_t(K)*ColumnBlock);
+    vector<double> Cre(RowBlock*ColumnBlock), Cim(RowBlock*ColumnBlock);
+    #pragma omp for schedule(static)
+    for(int i_b=0; i_b<NBlocks; ++i_b) {
+      const int j0 = i_b*ColumnBlock;
+      const int nb = std::min(ColumnBlock, N-j0);
+      // Copy this panel of B
+      for(int k=0; k<K; ++k) {
+        const complex<double>* B_k = B+std::ptrdiff_t(k)*ldb+j0;
+        double* __restrict bre = &Bre[std::size_t(k)*ColumnBlock];
+        double* __restrict bim = &Bim[std::size_t(k)*ColumnBlock];
+        for(int jj=0; jj<nb; ++jj) {
+          bre[jj] = B_k[jj].real();
+          bim[jj] = B_k[jj].imag();
+        }
+      }
+      // Accumulate RowBlock rows of C at a time
+      for(int i0=0; i0<M; i0+=RowBlock) {
+        const int mb = std::min(RowBlock, M-i0);
+        std::fill(Cre.begin(), Cre.end(), 0.0);
+        std::fill(Cim.begin(), Cim.end(), 0.0);
+        for(int k=0; k<K; ++k) {
+          const double* __restrict bre = &Bre[std::size_t(k)*ColumnBlock];
+          const double* __restrict bim = &Bim[std::size_t(k)*ColumnBlock];
+          for(int r=0; r<mb; ++r) {
+            const complex<double> a = A[std::ptrdiff_t(i0+r)*lda+k];
+            const double are = a.real(), aim = a.imag();
+            double* __restrict cre = &Cre[r*ColumnBlock];
+            double* __restrict cim = &Cim[r*ColumnBlock];
+            for(int jj=0; jj<nb; ++jj) {
+              cre[jj] += are*bre[jj] - aim*bim[jj];
+              cim[jj] += are*bim[jj] + aim*bre[jj];
+            }
+          }
+        }
+        for(int r=0; r<mb; ++r) {
+          complex<double>* C_r = C+std::ptrdiff_t(i0+r)*ldc+j0;
+          for(int jj=0; jj<nb; ++jj) {
+            C_r[jj] = complex<double>(Cre[r*ColumnBlock+jj], Cim[r*ColumnBlock+jj]);
+          }
+        }
+      }
+    }
   }
+#endif // USE_CBLAS
 }
 
 
@@ -7,10 +7,15 @@
 #include <vector>
 #include <complex>
 #include <iostream>
+#include <memory>
 #include <gsl/gsl_matrix.h>
 
 namespace GWFrames {
 
+  // Threading
+  void SetNumThreads(const int N);
+  int NumThreads();
+
   // Typedefs
   typedef std::vector<double> ThreeVector; // Can be assumed to have three components
   typedef std::vector<double> FourVector; // Can be assumed to have four components
@@ -43,6 +48,8 @@ namespace GWFrames {
   double CumulativeScalarIntegral(const std::vector<double>& fdot, const std::vector<double>& t);
   std::vector<double> ScalarDerivative(const std::vector<double>& f, const std::vector<double>& t);
   std::vector<std::complex<double> > ComplexDerivative(const std::vector<std::complex<double> >& f, const std::vector<double>& t);
+  void ComplexDerivative(const std::complex<double>* f, const double* t, const unsigned int N,
+                         const unsigned int i_a, const unsigned int i_b, std::complex<double>* D);
   std::vector<std::vector<double> > VectorIntegral(const std::vector<std::vector<double> >& fdot, const std::vector<double>& t);
   std::vector<double> CumulativeVectorIntegral(const std::vector<std::vector<double> >& fdot, const std::vector<double>& t);
 
@@ -96,9 +103,13 @@ namespace GWFrames {
   /// Rectangular array of complex data; probably not needed directly
   class MatrixC {
   private:
-    int nn;
-    int mm;
-    std::complex<double> **v;
+    int nn; // number of rows
+    int mm; // number of columns
+    int ld; // distance between the starts of consecutive rows
+    std::complex<double>* v; // first element of the first row
+    std::shared_ptr<void> owner; // keeps the storage alive; empty for unowned views
+    void allocate(int n, int m);
+    bool exclusive() const;
   public:
     MatrixC();
     MatrixC(int n, int m);			// Zero-based array
@@ -106,18 +117,29 @@ namespace GWFrames {
     MatrixC(int n, int m, const std::complex<double> *a);	// Initialize to array
     MatrixC(const std::vector<std::vector<std::complex<double> > >& DataIn);
     MatrixC(const MatrixC &rhs);		// Copy constructor
+    MatrixC(MatrixC &&rhs);			// Move constructor
     MatrixC& operator=(const MatrixC &rhs);	//assignment
+    MatrixC& operator=(MatrixC &&rhs);	// move assignment
     void swap(MatrixC& b);
-    inline std::complex<double>* operator[](const int i) { return v[i]; }
-    inline const std::complex<double>* operator[](const int i) const { return v[i]; }
+    static MatrixC View(int n, int m, std::complex<double>* a, int LeadingDimension=-1);
+    static MatrixC Adopt(int n, int m, std::complex<double>* a, const std::shared_ptr<void>& Owner, int LeadingDimension=-1);
+    inline std::complex<double>* operator[](const int i) { return v+std::ptrdiff_t(i)*ld; }
+    inline const std::complex<double>* operator[](const int i) const { return v+std::ptrdiff_t(i)*ld; }
     inline int nrows() const { return nn; }
     inline int ncols() const { return mm; }
+    inline int stride() const { return ld; }
+    inline bool contiguous() const { return ld==mm || nn<2; }
+    inline bool owns() const { return bool(owner); }
     // / \@cond
     void resize(int newn, int newm); // resize (contents not preserved)
     // / \@endcond
     void assign(int newn, int newm, const std::complex<double> &a); // resize and assign a constant value
     ~MatrixC();
   };
+  void ComplexMatrixProduct(const int M, const int N, const int K,
+                            const std::complex<double>* A, const int lda,
+                            const std::complex<double>* B, const int ldb,
+                            std::complex<double>* C, const int ldc);
 
   std::ostream& operator<<(std::ostream& out, const std::vector<double>& v);
   std::ostream& operator<<(std::ostream& out, const std::vector<int>& v);
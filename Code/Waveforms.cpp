@@ -12,6 +12,11 @@
 #include <cmath>
 
 #include <sys/time.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <cstring>
 #include <ctime>
 
 #include <functional>
@@ -32,6 +37,7 @@
 #include "Quaternions/QuaternionUtilities.hpp"
 #include "IntegrateAngularVelocity.hpp"
 #include "SphericalFunctions/SWSHs.hpp"
+#include "fft.hpp"
 #include "Errors.hpp"
 
 using Quaternions::Quaternion;
@@ -66,6 +72,10 @@ using std::complex;
 
 const complex<double> ImaginaryI(0.0,1.0);
 
+// Loops over fewer time steps than this are not worth splitting among
+// threads (see GWFrames::SetNumThreads)
+const int ParallelTimeThreshold = 512;
+
 const LadderOperatorFactorSingleton& LadderOperatorFactor = LadderOperatorFactorSingleton::Instance();
 
 std::string tolower(const std::string& A) {
@@ -91,7 +101,7 @@ std::string StringForm(const std::vector<int>& Lmodes) {
 /// Default constructor for an empty object
 GWFrames::Waveform::Waveform() :
   spinweight(-2), boostweight(-1), history(""), versionHist(), t(0), frame(0), frameType(GWFrames::UnknownFrameType),
-  dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(), data()
+  dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(), lmIndex(), data()
 {
   {
     char path[MAXPATHLEN];
@@ -106,7 +116,9 @@ GWFrames::Waveform::Waveform() :
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history << "# Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << endl
             << "# pwd = " << pwd << endl
             << "# hostname = " << hostname << endl
@@ -119,21 +131,36 @@ GWFrames::Waveform::Waveform() :
 GWFrames::Waveform::Waveform(const GWFrames::Waveform& a) :
   spinweight(a.spinweight), boostweight(a.boostweight), history(a.history.str()), versionHist(a.versionHist),
   t(a.t), frame(a.frame), frameType(a.frameType), dataType(a.dataType), rIsScaledOut(a.rIsScaledOut),
-  mIsScaledOut(a.mIsScaledOut), lm(a.lm), data(a.data)
+  mIsScaledOut(a.mIsScaledOut), lm(a.lm), lmIndex(a.lmIndex), data(a.data)
 {
   /// Simply copies all fields in the input object to the constructed
   /// object, including history
   history.seekp(0, ios_base::end);
 }
 
+/// Move constructor
+GWFrames::Waveform::Waveform(GWFrames::Waveform&& a) :
+  spinweight(a.spinweight), boostweight(a.boostweight), history(std::move(a.history)), versionHist(std::move(a.versionHist)),
+  t(std::move(a.t)), frame(std::move(a.frame)), frameType(a.frameType), dataType(a.dataType), rIsScaledOut(a.rIsScaledOut),
+  mIsScaledOut(a.mIsScaledOut), lm(std::move(a.lm)), lmIndex(std::move(a.lmIndex)), data(std::move(a.data))
+{
+  /// Takes over the data (including history) of the input object,
+  /// which is left empty but valid
+  history.seekp(0, ios_base::end);
+}
+
 /// Constructor from data file
 GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& DataFormat) :
   spinweight(-2), boostweight(-1), history(""), versionHist(), t(0), frame(0), frameType(GWFrames::UnknownFrameType),
-  dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(), data()
+  dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(), lmIndex(), data()
 {
   ///
   /// \param FileName Relative path to data file
-  /// \param DataFormat Either 'ReIm' or 'MagArg'
+  /// \param DataFormat Either 'ReIm', 'MagArg', or 'Binary'
+  ///
+  /// The 'Binary' format is the one written by `OutputBinary`; it
+  /// stores all of the metadata (including the (ell,m) data), so the
+  /// note below does not apply to it.
   ///
   /// NOTE: This function assumes that the data are stored as (ell,m)
   /// modes, starting with (2,-2), incrementing m, then incrementing
@@ -154,7 +181,9 @@ GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& Dat
     string hostname = host;
     time_t rawtime;
     time ( &rawtime );
-    string date = asctime ( localtime ( &rawtime ) );
+    struct tm timeinfo;
+    char datebuffer[32];
+    string date = asctime_r ( localtime_r ( &rawtime, &timeinfo ), datebuffer );
     history << "# Code revision (`git rev-parse HEAD` or arXiv version) = " << CodeRevision << endl
             << "# pwd = " << pwd << endl
             << "# hostname = " << hostname << endl
@@ -162,23 +191,33 @@ GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& Dat
             << "Waveform(" << FileName << ", " << DataFormat << "); // Constructor from data file" << endl;
   }
 
-  // Get the number of lines in the file
-  char LengthChar[9];
-  FILE* fp = popen(("wc -l " + FileName).c_str(), "r");
-  if(!fp) {
-    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Cannot call wc to get size of '" << FileName << "'" << endl;
-    throw(GWFrames_FailedSystemCall);
+  // The native binary format carries its own metadata, so it is
+  // read separately
+  if(tolower(DataFormat).find("binary")!=string::npos) {
+    ReadBinary(FileName);
+    return;
   }
-  if(fgets(LengthChar, 9, fp) == NULL) {
-    cerr << "\n\n";
-    if(ferror(fp)) {
-      cerr << __FILE__ << ":" << __LINE__ << ": Read error in popen while calling wc. LengthChar='" << LengthChar << "'" << endl;
+
+  // Get the number of lines in the file (counted in-process, rather
+  // than by calling `wc -l`)
+  int FileLength = 0;
+  {
+    ifstream ifs(FileName.c_str(), ifstream::in | ifstream::binary);
+    if(!ifs.is_open()) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "'" << endl;
+      throw(GWFrames_BadFileName);
     }
-    cerr << __FILE__ << ":" << __LINE__ << ": Failed calling wc to get size of '" << FileName << "'" << endl;
-    throw(GWFrames_FailedSystemCall);
+    vector<char> Buffer(1<<20);
+    char LastChar = '\n';
+    while(ifs) {
+      ifs.read(&Buffer[0], Buffer.size());
+      const std::streamsize NRead = ifs.gcount();
+      if(NRead<=0) { break; }
+      FileLength += std::count(Buffer.begin(), Buffer.begin()+NRead, '\n');
+      LastChar = Buffer[NRead-1];
+    }
+    if(LastChar!='\n') { ++FileLength; } // Final line has no newline
   }
-  pclose(fp);
-  const int FileLength = atoi(LengthChar);
 
   // Open the input file stream
   ifstream ifs(FileName.c_str(), ifstream::in);
@@ -261,6 +300,7 @@ GWFrames::Waveform::Waveform(const std::string& FileName, const std::string& Dat
       }
     }
   }
+  UpdateLMIndex();
 }
 
 /// Assignment operator
@@ -278,10 +318,32 @@ GWFrames::Waveform& GWFrames::Waveform::operator=(const GWFrames::Waveform& a) {
   rIsScaledOut = a.rIsScaledOut;
   mIsScaledOut = a.mIsScaledOut;
   lm = a.lm;
+  lmIndex = a.lmIndex;
   data = a.data;
   return *this;
 }
 
+/// Move assignment operator
+GWFrames::Waveform& GWFrames::Waveform::operator=(GWFrames::Waveform&& a) {
+  if(this != &a) {
+    spinweight = a.spinweight;
+    boostweight = a.boostweight;
+    history.swap(a.history);
+    history.seekp(0, ios_base::end);
+    versionHist.swap(a.versionHist);
+    t.swap(a.t);
+    frame.swap(a.frame);
+    frameType = a.frameType;
+    dataType = a.dataType;
+    rIsScaledOut = a.rIsScaledOut;
+    mIsScaledOut = a.mIsScaledOut;
+    lm.swap(a.lm);
+    lmIndex.swap(a.lmIndex);
+    data = std::move(a.data);
+  }
+  return *this;
+}
+
 /// Copy the Waveform, except for the data (t, frame, lm, data)
 GWFrames::Waveform GWFrames::Waveform::CopyWithoutData() const {
   Waveform that;
@@ -328,13 +390,12 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndices(const unsigned int i_t
   Waveform Slice = this->CopyWithoutData();
   Slice.history << "this->SliceOfTimeIndices(" << i_t_a << ", " << i_t_b << ");" << std::endl;
   Slice.lm = lm;
+  Slice.lmIndex = lmIndex;
   const unsigned int ntimes = i_t_b-i_t_a;
   const unsigned int nmodes = NModes();
   Slice.data.resize(nmodes, ntimes);
   for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
-    for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
-      Slice.data[i_m][i_t] = data[i_m][i_t+i_t_a];
-    }
+    std::copy(data[i_m]+i_t_a, data[i_m]+i_t_b, Slice.data[i_m]);
   }
   if(frame.size() == NTimes()) {
     Slice.frame = vector<Quaternion>(frame.begin()+i_t_a, frame.begin()+i_t_b);
@@ -348,6 +409,50 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndices(const unsigned int i_t
   return Slice;
 }
 
+/// Copy of the Waveform at the given time indices
+GWFrames::Waveform GWFrames::Waveform::SubsetOfTimeIndices(const std::vector<unsigned int>& Indices) const {
+  ///
+  /// \param Indices Strictly increasing indices of the times to keep
+  ///
+  /// The frame (if it is given at each time step) is also taken at
+  /// the given indices.
+  for(unsigned int i=0; i<Indices.size(); ++i) {
+    if(Indices[i]>=NTimes() || (i>0 && Indices[i]<=Indices[i-1])) {
+      INFOTOCERR << ": Requesting impossible subset"
+                 << "\nIndices[" << i << "]=" << Indices[i] << " with NTimes()=" << NTimes() << std::endl;
+      throw(GWFrames_IndexOutOfBounds);
+    }
+  }
+  Waveform Subset = this->CopyWithoutData();
+  Subset.history << "this->SubsetOfTimeIndices(Indices);" << std::endl;
+  Subset.lm = lm;
+  Subset.lmIndex = lmIndex;
+  const unsigned int ntimes = Indices.size();
+  const unsigned int nmodes = NModes();
+  Subset.data.resize(nmodes, ntimes);
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    for(unsigned int i=0; i<ntimes; ++i) {
+      Subset.data[i_m][i] = data[i_m][Indices[i]];
+    }
+  }
+  if(frame.size() == NTimes()) {
+    Subset.frame.resize(ntimes);
+    for(unsigned int i=0; i<ntimes; ++i) {
+      Subset.frame[i] = frame[Indices[i]];
+    }
+  } else if(frame.size()==1) {
+    Subset.frame = frame;
+  } else if(frame.size()!=0) {
+    INFOTOCERR << " I don't understand what to do with frame data of length " << frame.size() << " in a Waveform with " << NTimes() << " times." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  Subset.t.resize(ntimes);
+  for(unsigned int i=0; i<ntimes; ++i) {
+    Subset.t[i] = t[Indices[i]];
+  }
+  return Subset;
+}
+
 /// Copy the Waveform between t_a and t_b
 GWFrames::Waveform GWFrames::Waveform::SliceOfTimes(const double t_a, const double t_b) const {
   const unsigned int i_t_a = Quaternions::hunt(t, t_a);
@@ -387,6 +492,7 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndicesWithEll2(const unsigned
       Slice.data[m+2][i_t] = data[i_m][i_t+i_t_a];
     }
   }
+  Slice.UpdateLMIndex();
   if(frame.size() == NTimes()) {
     Slice.frame = vector<Quaternion>(frame.begin()+i_t_a, frame.begin()+i_t_b);
   } else if(frame.size()==1) {
@@ -417,6 +523,7 @@ GWFrames::Waveform GWFrames::Waveform::SliceOfTimeIndicesWithoutModes(const unsi
     i_t_b = i_t_a+1;
   }
   Slice.lm = vector<vector<int> >(0, vector<int>(2));
+  Slice.lmIndex.clear();
   const unsigned int ntimes = i_t_b-i_t_a;
   const unsigned int nmodes = 0;
   Slice.data.resize(nmodes, ntimes);
@@ -481,6 +588,7 @@ GWFrames::Waveform& GWFrames::Waveform::DropEllModes(const std::vector<unsigned
     }
   }
   lm = newlm;
+  UpdateLMIndex();
   vector<vector<complex<double> > > NewData(IndicesToKeep.size(), vector<complex<double> >(NTimes()));
   for(unsigned int i_m=0; i_m<IndicesToKeep.size(); ++i_m) {
     NewData[i_m] = Data(IndicesToKeep[i_m]);
@@ -508,6 +616,7 @@ GWFrames::Waveform& GWFrames::Waveform::KeepOnlyEllModes(const std::vector<unsig
     }
   }
   lm = newlm;
+  UpdateLMIndex();
   vector<vector<complex<double> > > NewData(IndicesToKeep.size(), vector<complex<double> >(NTimes()));
   for(unsigned int i_m=0; i_m<IndicesToKeep.size(); ++i_m) {
     NewData[i_m] = Data(IndicesToKeep[i_m]);
@@ -525,14 +634,14 @@ GWFrames::Waveform& GWFrames::Waveform::KeepOnlyEll2() {
 
 /// Efficiently swap data between two Waveform objects.
 void GWFrames::Waveform::swap(GWFrames::Waveform& b) {
-  /// This function uses the std::vector method 'swap' which simply
-  /// swaps pointers to data, for efficiency.
+  /// This function uses the 'swap' methods of the members, which
+  /// simply swap pointers to data, for efficiency.
 
   // This call should not be recorded explicitly in the history,
   // because the histories are swapped
   { const int NewSpinWeight=b.spinweight; b.spinweight=spinweight; spinweight=NewSpinWeight; }
   { const int NewBoostWeight=b.boostweight; b.boostweight=boostweight; boostweight=NewBoostWeight; }
-  { const string historyb=b.history.str(); b.history.str(history.str()); history.str(historyb); }
+  history.swap(b.history);
   history.seekp(0, ios_base::end);
   b.history.seekp(0, ios_base::end);
   versionHist.swap(b.versionHist);
@@ -543,6 +652,7 @@ void GWFrames::Waveform::swap(GWFrames::Waveform& b) {
   { const bool brIsScaledOut=b.rIsScaledOut; b.rIsScaledOut=rIsScaledOut; rIsScaledOut=brIsScaledOut; }
   { const bool bmIsScaledOut=b.mIsScaledOut; b.mIsScaledOut=mIsScaledOut; mIsScaledOut=bmIsScaledOut; }
   lm.swap(b.lm);
+  lmIndex.swap(b.lmIndex);
   data.swap(b.data);
   return;
 }
@@ -552,10 +662,12 @@ void GWFrames::Waveform::swap(GWFrames::Waveform& b) {
 GWFrames::Waveform::Waveform(const std::vector<double>& T, const std::vector<std::vector<int> >& LM,
                              const std::vector<std::vector<std::complex<double> > >& Data)
   : spinweight(-2), boostweight(-1), history(""), t(T), frame(), frameType(GWFrames::UnknownFrameType),
-    dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(LM), data(Data)
+    dataType(GWFrames::UnknownDataType), rIsScaledOut(false), mIsScaledOut(false), lm(LM), lmIndex(), data(Data)
 {
   /// Arguments are T, LM, Data, which consist of the explicit data.
 
+  UpdateLMIndex();
+
   // Check that dimensions match (though this is not an exhaustive check)
   if( Data.size()!=0 && ( (t.size() != Data[0].size()) || (Data.size() != lm.size()) ) ) {
     cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": t.size()=" << t.size()
@@ -829,16 +941,31 @@ int GWFrames::Waveform::EllMax() const {
   return ell;
 }
 
+/// Rebuild the (ell,m)->index table from the lm data
+void GWFrames::Waveform::UpdateLMIndex() {
+  /// This stores the row of `data` holding each (ell,m) mode in a
+  /// dense table, so that FindModeIndex is a single lookup.  Where
+  /// a mode appears more than once, the first occurrence wins, as
+  /// with a linear search.
+  int ellMax = -1;
+  for(unsigned int i=0; i<lm.size(); ++i) {
+    if(lm[i].size()>1 && lm[i][0]>ellMax) { ellMax = lm[i][0]; }
+  }
+  lmIndex.assign((ellMax+1)*(ellMax+1), -1);
+  for(unsigned int i=0; i<lm.size(); ++i) {
+    if(lm[i].size()<2) { continue; }
+    const int ell = lm[i][0];
+    const int m = lm[i][1];
+    if(ell<0 || std::abs(m)>ell) { continue; }
+    int& index = lmIndex[ell*(ell+1)+m];
+    if(index<0) { index = i; }
+  }
+}
+
 /// Find index of mode with given (l,m) data.
 unsigned int GWFrames::Waveform::FindModeIndex(const int l, const int m) const {
-  const unsigned int i_expected = l*(l+1) + m - SpinWeight()*SpinWeight();
-  if (lm.size() > i_expected) {
-    if(lm[i_expected][0]==l && lm[i_expected][1]==m) { return i_expected; }
-  }
-  //ORIENTATION!!! following loop
-  for(unsigned int i=0; i<NModes(); ++i) {
-    if(lm[i][0]==l && lm[i][1]==m) { return i; }
-  }
+  const unsigned int i = FindModeIndexWithoutError(l, m);
+  if(i<lm.size()) { return i; }
   INFOTOCERR << " Can't find (ell,m)=(" << l << ", " << m << ")" << endl;
   throw(GWFrames_WaveformMissingLMIndex);
 }
@@ -847,11 +974,13 @@ unsigned int GWFrames::Waveform::FindModeIndex(const int l, const int m) const {
 unsigned int GWFrames::Waveform::FindModeIndexWithoutError(const int l, const int m) const {
   /// If the requested mode is not present, the returned index is 1
   /// beyond the end of the mode vector.
-  const unsigned int i_expected = l*(l+1) + m - SpinWeight()*SpinWeight();
-  if(lm[i_expected][0]==l && lm[i_expected][1]==m) { return i_expected; }
-  // ORIENTATION!!! following loop
+  if(l>=0 && std::abs(m)<=l && l*(l+1)+m<int(lmIndex.size())) {
+    const int i = lmIndex[l*(l+1)+m];
+    if(i>=0 && i<int(lm.size()) && lm[i][0]==l && lm[i][1]==m) { return i; }
+  }
+  // Fall back on a search, in case lm was changed without updating lmIndex
   unsigned int i=0;
-  for(; i<NModes(); ++i) {
+  for(; i<lm.size(); ++i) {
     if(lm[i][0]==l && lm[i][1]==m) { return i; }
   }
   ++i;
@@ -877,30 +1006,54 @@ std::vector<double> GWFrames::Waveform::NormalizedAntisymmetry(std::vector<int>
 
   const unsigned int ntimes = NTimes();
   const int ellMax = EllMax();
+  const unsigned int nmodes = lm.size();
+
+  // Look up the modes once, rather than at each time step.  Missing
+  // modes are simply treated as zero.
+  vector<unsigned int> i_m, i_mm;
+  vector<double> sign;
+  vector<unsigned int> i_norm;
+  for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    const bool UseForAsymmetry = (LModesForAsymmetry.size()==0 || GWFrames::xINy(ell,LModesForAsymmetry));
+    for(int m=-ell; m<=ell; ++m) {
+      const unsigned int i = FindModeIndexWithoutError(ell,m);
+      if(i<nmodes) { i_norm.push_back(i); }
+      if(UseForAsymmetry) {
+        const unsigned int j = FindModeIndexWithoutError(ell,-m);
+        if(i<nmodes && j<nmodes) {
+          i_m.push_back(i);
+          i_mm.push_back(j);
+          sign.push_back(((ell+m)%2)==0 ? -1.0 : 1.0);
+        } else if(i<nmodes) {
+          i_m.push_back(i);
+          i_mm.push_back(i);
+          sign.push_back(0.0);
+        } else if(j<nmodes) {
+          i_m.push_back(j);
+          i_mm.push_back(j);
+          sign.push_back(0.0);
+        }
+      }
+    }
+  }
+
   std::vector<double> asymmetry(ntimes);
-  double diff,norm;
   for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
-    diff = 0.;
-    norm = 0.;
-    for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      if(LModesForAsymmetry.size()==0 || GWFrames::xINy(ell,LModesForAsymmetry)) {
-        for(int m=-ell; m<=ell; ++m) {
-          const complex<double> h_ell_m = Data(FindModeIndexWithoutError(ell,m), i_t);
-          const complex<double> hbar_ell_mm = std::conj(Data(FindModeIndexWithoutError(ell,-m), i_t));
-          if(((ell+m)%2)==0) {
-            diff += std::norm(h_ell_m - hbar_ell_mm);
-          } else {
-            diff += std::norm(h_ell_m + hbar_ell_mm);
-          }
-          norm += std::norm(h_ell_m);
-        }
-      } else{
-        for(int m=-ell; m<=ell; ++m) {
-          const complex<double> h_ell_m = Data(FindModeIndexWithoutError(ell,m), i_t);
-          norm += std::norm(h_ell_m);
-        }
+    double diff = 0.;
+    double norm = 0.;
+    for(unsigned int i=0; i<i_m.size(); ++i) {
+      const complex<double> h_ell_m = data[i_m[i]][i_t];
+      const complex<double> hbar_ell_mm = std::conj(data[i_mm[i]][i_t]);
+      if(sign[i]==0.0) {
+        // Only one of the pair (ell,m), (ell,-m) is present
+        diff += std::norm(h_ell_m);
+      } else {
+        diff += std::norm(h_ell_m + sign[i]*hbar_ell_mm);
       }
     }
+    for(unsigned int i=0; i<i_norm.size(); ++i) {
+      norm += std::norm(data[i_norm[i]][i_t]);
+    }
     asymmetry[i_t] = std::sqrt(diff/(4*norm));
   }
   return asymmetry;
@@ -920,54 +1073,54 @@ std::vector<std::vector<double> > GWFrames::Waveform::DipoleMoment(int ellMax) c
     ellMax = EllMax();
   }
 
-  vector<vector<double> > D(NTimes(), vector<double>(3));
-  vector<complex<double> > d(3);
-
-  for(int i_t=0; i_t<NTimes(); ++i_t) {
-    d[0] = 0.0;
-    d[1] = 0.0;
-    d[2] = 0.0;
-    for(int ell=2; ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m) {
-        for(int ellPrime=std::max(ell-1,2); ellPrime<=std::min(ell+1,ellMax); ++ellPrime) {
-          const double sqrtFactor = std::sqrt((2*ell+1)*(2*ellPrime+1)/2.);
-          const double Wigner3j_A = Wigner3j(ell, ellPrime, 1, 2, -2, 0);
-          for(int mPrime=std::max(m-1,-ellPrime); mPrime<=std::min(m+1,ellPrime); ++mPrime) {
-            // This is the whole thing, except for the n_j modes
-            if(mPrime%2 == 0) {
-              const complex<double> BasicFactor = Data(FindModeIndex(ell,m), i_t) * std::conj(Data(FindModeIndex(ellPrime,mPrime), i_t))
-                * sqrtFactor * Wigner3j(ell, ellPrime, 1, m, -mPrime, mPrime-m) * Wigner3j_A;
-              if(mPrime==m) { // This will only affect the z component
-                d[2] += std::sqrt(2) * BasicFactor;
-              } else { // This will only affect the x and y components
-                d[0] += (mPrime-m==1 ? -1. : 1.) * BasicFactor;
-                d[1] += ImaginaryI * BasicFactor;
-              }
-            } else {
-              const complex<double> BasicFactor = -Data(FindModeIndex(ell,m), i_t) * std::conj(Data(FindModeIndex(ellPrime,mPrime), i_t))
-                * sqrtFactor * Wigner3j(ell, ellPrime, 1, m, -mPrime, mPrime-m) * Wigner3j_A;
-              if(mPrime==m) { // This will only affect the z component
-                d[2] += std::sqrt(2) * BasicFactor;
-              } else { // This will only affect the x and y components
-                d[0] += (mPrime-m==1 ? -1. : 1.) * BasicFactor;
-                d[1] += ImaginaryI * BasicFactor;
-              }
-            }
-            // if(d[0]!=d[0] || d[1]!=d[1] || d[2]!=d[2]) { // DEBUG NANs
-            //   INFOTOCERR << i_t << ": (" << ell << "," << m << "); (" << ellPrime << "," << mPrime
-            //              << ")\n" << Data(FindModeIndex(ell,m), i_t) << " * " << std::conj(Data(FindModeIndex(ellPrime,mPrime), i_t))
-            //              << " * " << std::pow(-1,mPrime) << "*" << sqrtFactor << " * " << Wigner3j(ell, ellPrime, 1, m, -mPrime, mPrime-m)
-            //              << " * " << Wigner3j_A
-            //              << "=" << BasicFactor << "\t[" << d[0] << "," << d[1] << "," << d[2] << "]" << std::endl;
-            //   throw(GWFrames_ValueError);
-            // }
+  // Each term in the sum is a product of a mode with the conjugate
+  // of a neighboring mode, times a coefficient that does not depend
+  // on time.  Evaluate the mode indices and coefficients just once.
+  // Only the real parts of d are returned, so we just need
+  //   Re(BasicFactor)  for the x and z components, and
+  //   Re(i*BasicFactor) = -Im(BasicFactor)  for the y component.
+  vector<unsigned int> i_A, i_B;
+  vector<double> c_x, c_y, c_z;
+  for(int ell=2; ell<=ellMax; ++ell) {
+    for(int m=-ell; m<=ell; ++m) {
+      for(int ellPrime=std::max(ell-1,2); ellPrime<=std::min(ell+1,ellMax); ++ellPrime) {
+        const double sqrtFactor = std::sqrt((2*ell+1)*(2*ellPrime+1)/2.);
+        const double Wigner3j_A = Wigner3j(ell, ellPrime, 1, 2, -2, 0);
+        for(int mPrime=std::max(m-1,-ellPrime); mPrime<=std::min(m+1,ellPrime); ++mPrime) {
+          // This is the whole thing, except for the mode data and the n_j modes
+          const double Factor = (mPrime%2 == 0 ? 1.0 : -1.0)
+            * sqrtFactor * Wigner3j(ell, ellPrime, 1, m, -mPrime, mPrime-m) * Wigner3j_A;
+          i_A.push_back(FindModeIndex(ell,m));
+          i_B.push_back(FindModeIndex(ellPrime,mPrime));
+          if(mPrime==m) { // This will only affect the z component
+            c_x.push_back(0.0);
+            c_y.push_back(0.0);
+            c_z.push_back(std::sqrt(2) * Factor);
+          } else { // This will only affect the x and y components
+            c_x.push_back((mPrime-m==1 ? -1. : 1.) * Factor);
+            c_y.push_back(-Factor);
+            c_z.push_back(0.0);
           }
         }
       }
     }
-    D[i_t][0] = d[0].real();
-    D[i_t][1] = d[1].real();
-    D[i_t][2] = d[2].real();
+  }
+
+  const int ntimes = NTimes();
+  const unsigned int nterms = i_A.size();
+  vector<vector<double> > D(ntimes, vector<double>(3));
+  #pragma omp parallel for if(ntimes>ParallelTimeThreshold)
+  for(int i_t=0; i_t<ntimes; ++i_t) {
+    double d_x = 0.0, d_y = 0.0, d_z = 0.0;
+    for(unsigned int i=0; i<nterms; ++i) {
+      const complex<double> Product = data[i_A[i]][i_t] * std::conj(data[i_B[i]][i_t]);
+      d_x += c_x[i] * Product.real();
+      d_y += c_y[i] * Product.imag();
+      d_z += c_z[i] * Product.real();
+    }
+    D[i_t][0] = d_x;
+    D[i_t][1] = d_y;
+    D[i_t][2] = d_z;
   }
 
   return D;
@@ -1006,6 +1159,7 @@ GWFrames::Waveform GWFrames::Waveform::Involution(WaveformInvolutionFunction WIn
     B.frame[i] = QInvol(A.frame[i]);
   }
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.data.resize(A.NModes(), A.NTimes());
   for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m) {
@@ -1031,6 +1185,7 @@ GWFrames::Waveform GWFrames::Waveform::InvolutionSymmetricPart(WaveformInvolutio
     B.frame[i] = 0.5 * ( A.frame[i] +  QInvol(A.frame[i]) );
   }
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.data.resize(A.NModes(), A.NTimes());
   for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m) {
@@ -1056,6 +1211,7 @@ GWFrames::Waveform GWFrames::Waveform::InvolutionAntisymmetricPart(WaveformInvol
     B.frame[i] = 0.5 * ( A.frame[i] -  QInvol(A.frame[i]) );
   }
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.data.resize(A.NModes(), A.NTimes());
   for(int ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
     for(int m=-ell; m<=ell; ++m) {
@@ -1343,6 +1499,60 @@ GWFrames::Waveform& GWFrames::Waveform::RotateDecompositionBasis(const std::vect
 
 
 /// Rotate modes of the Waveform object.
+#ifndef DOXYGEN
+namespace {
+  // Number of time steps processed together when rotating modes.
+  // The D matrices for one ell and one block must fit comfortably in
+  // cache: for ell=8, this is 289*32*16 bytes, or about 150 kB.
+  const int WignerDTimeBlockSize = 32;
+
+  // Store D^{(l)}_{m',m} for the current rotation of D at time
+  // indices [tt, tt+nt) of a block with TimeBlock time steps.  The
+  // layout is D[(m'+l)*(2l+1)+(m+l)][tt].
+  void FillWignerDBlock(const SphericalFunctions::WignerDMatrix& D, const int l, const int tt, const int nt,
+                        const int TimeBlock, double* Dre, double* Dim) {
+    const int N = 2*l+1;
+    for(int mp=-l; mp<=l; ++mp) {
+      for(int m=-l; m<=l; ++m) {
+        const complex<double> d = D(l,mp,m);
+        const int i = ((mp+l)*N+(m+l))*TimeBlock;
+        for(int j=tt; j<tt+nt; ++j) {
+          Dre[i+j] = d.real();
+          Dim[i+j] = d.imag();
+        }
+      }
+    }
+  }
+
+  // Y[m][tt] = \sum_{m'} D[m'][m][tt] X[m'][tt] for tt in [0, nt),
+  // with real and imaginary parts stored separately so that the
+  // innermost loop is a unit-stride (vectorizable) complex FMA.
+  void ApplyWignerDBlock(const int N, const int nt, const int TimeBlock,
+                         const double* __restrict Dre, const double* __restrict Dim,
+                         const double* __restrict Xre, const double* __restrict Xim,
+                         double* __restrict Yre, double* __restrict Yim) {
+    for(int m=0; m<N; ++m) {
+      double* __restrict yre = Yre+m*TimeBlock;
+      double* __restrict yim = Yim+m*TimeBlock;
+      for(int tt=0; tt<nt; ++tt) {
+        yre[tt] = 0.0;
+        yim[tt] = 0.0;
+      }
+      for(int mp=0; mp<N; ++mp) {
+        const double* __restrict dre = Dre+(mp*N+m)*TimeBlock;
+        const double* __restrict dim = Dim+(mp*N+m)*TimeBlock;
+        const double* __restrict xre = Xre+mp*TimeBlock;
+        const double* __restrict xim = Xim+mp*TimeBlock;
+        for(int tt=0; tt<nt; ++tt) {
+          yre[tt] += dre[tt]*xre[tt] - dim[tt]*xim[tt];
+          yim[tt] += dre[tt]*xim[tt] + dim[tt]*xre[tt];
+        }
+      }
+    }
+  }
+}
+#endif // DOXYGEN
+
 GWFrames::Waveform& GWFrames::Waveform::TransformModesToRotatedFrame(const std::vector<Quaternion>& R_frame) {
   /// Given a Waveform object, alter the modes stored in this Waveform
   /// so that it measures the same physical field with respect to a
@@ -1365,86 +1575,364 @@ GWFrames::Waveform& GWFrames::Waveform::TransformModesToRotatedFrame(const std::
     throw(GWFrames_VectorSizeMismatch);
   }
 
-  // Loop through each mode and do the rotation
+  // Find the ell values present, and the indices of their modes.
+  // Use a vector of mode indices, in case the modes are out of
+  // order.  This still assumes that we have each l from l=2 up to
+  // some l_max, but it's better than assuming that, plus assuming
+  // that everything is in order.
+  vector<int> ells;
+  vector<vector<unsigned int> > ModeIndices;
   {
     int mode=1;
     for(int l=std::abs(SpinWeight()); l<NModes; ++l) {
       if(NModes<mode) { break; }
-
-      // Use a vector of mode indices, in case the modes are out of
-      // order.  This still assumes that we have each l from l=2 up to
-      // some l_max, but it's better than assuming that, plus assuming
-      // that everything is in order.
-      vector<unsigned int> ModeIndices(2*l+1);
+      vector<unsigned int> ModeIndices_l(2*l+1);
       for(int m=-l, i=0; m<=l; ++m, ++i) {
         try {
-          ModeIndices[i] = FindModeIndex(l, m);
+          ModeIndices_l[i] = FindModeIndex(l, m);
         } catch(int thrown) {
           cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Incomplete mode information in Waveform; cannot rotate." << endl;
           throw(thrown);
         }
       }
+      ells.push_back(l);
+      ModeIndices.push_back(ModeIndices_l);
+      mode += 2*l+1;
+    }
+  }
 
-      {
+  // Loop through each ell, and then through blocks of time steps.
+  // For each block, the D matrices are evaluated once per time step
+  // and stored with time as the fastest index, next to a copy of
+  // the mode data in the same layout, so that the mat-vec is a set
+  // of unit-stride loops over time that the compiler can vectorize.
+  // The blocks are independent, so they are shared among threads,
+  // each of which has its own D matrix and scratch space.
+  const int TimeBlock = WignerDTimeBlockSize;
+  const int NBlocks = (NTimes+TimeBlock-1)/TimeBlock;
+  for(unsigned int i_l=0; i_l<ells.size(); ++i_l) {
+    const int l = ells[i_l];
+    const int N = 2*l+1;
+    const vector<unsigned int>& Indices = ModeIndices[i_l];
+    #pragma omp parallel if(NBlocks>1)
+    {
+      SphericalFunctions::WignerDMatrix D(R_frame[0]);
+      vector<double> Dre(N*N*TimeBlock), Dim(N*N*TimeBlock);
+      vector<double> Xre(N*TimeBlock), Xim(N*TimeBlock), Yre(N*TimeBlock), Yim(N*TimeBlock);
+
+      if(R_frame.size()==1) {
+        // Get the Wigner D matrix data just once
+        FillWignerDBlock(D, l, 0, TimeBlock, TimeBlock, &Dre[0], &Dim[0]);
+      }
 
-        // Construct the D matrix and data storage
-        SphericalFunctions::WignerDMatrix D(R_frame[0]);
-        vector<vector<complex<double> > > Ds(2*l+1, vector<complex<double> >(2*l+1));
-        vector<complex<double> > Data(2*l+1);
-
-        if(R_frame.size()==1) {
-          // Get the Wigner D matrix data just once
-          for(int m=-l; m<=l; ++m) {
-            for(int mp=-l; mp<=l; ++mp) {
-              Ds[mp+l][m+l] = D(l,mp,m);
-            }
+      #pragma omp for schedule(static)
+      for(int i_b=0; i_b<NBlocks; ++i_b) {
+        const int t0 = i_b*TimeBlock;
+        const int nt = std::min(TimeBlock, NTimes-t0);
+        if(R_frame.size()!=1) {
+          // Get the Wigner D matrix data at each time step in this block
+          for(int tt=0; tt<nt; ++tt) {
+            D.SetRotation(R_frame[t0+tt]);
+            FillWignerDBlock(D, l, tt, 1, TimeBlock, &Dre[0], &Dim[0]);
           }
-          // Loop through each time step
-          for(int t=0; t<NTimes; ++t) {
-            // Store the data for all m' modes at this time step
-            for(int mp=-l, i=0; mp<=l; ++mp, ++i) {
-              Data[mp+l] = this->operator()(ModeIndices[i], t);
-            }
-            // Compute the data at this time step for each m
-            for(int m=-l, i=0; m<=l; ++m, ++i) {
-              data[ModeIndices[i]][t] = 0.0;
-              for(int mp=-l; mp<=l; ++mp) { // Sum over m'
-                data[ModeIndices[i]][t] += Ds[mp+l][m+l]*Data[mp+l];
-              }
-            }
+        }
+        // Store the data for all m' modes in this block
+        for(int i=0; i<N; ++i) {
+          const complex<double>* Data = data[Indices[i]]+t0;
+          for(int tt=0; tt<nt; ++tt) {
+            Xre[i*TimeBlock+tt] = Data[tt].real();
+            Xim[i*TimeBlock+tt] = Data[tt].imag();
           }
-        } else {
-          // Loop through each time step
-          for(int t=0; t<NTimes; ++t) {
-            // Get the Wigner D matrix data at this time step
-            D.SetRotation(R_frame[t]);
-            for(int m=-l; m<=l; ++m) {
-              for(int mp=-l; mp<=l; ++mp) {
-                Ds[mp+l][m+l] = D(l,mp,m);
-              }
-            }
-            // Store the data for all m' modes at this time step
-            for(int mp=-l, i=0; mp<=l; ++mp, ++i) {
-              Data[mp+l] = this->operator()(ModeIndices[i], t);
-            }
-            // Compute the data at this time step for each m
-            for(int m=-l, i=0; m<=l; ++m, ++i) {
-              data[ModeIndices[i]][t] = 0.0;
-              for(int mp=-l; mp<=l; ++mp) { // Sum over m'
-                data[ModeIndices[i]][t] += Ds[mp+l][m+l]*Data[mp+l];
-              }
-            }
+        }
+        // Compute the data in this block for each m
+        ApplyWignerDBlock(N, nt, TimeBlock, &Dre[0], &Dim[0], &Xre[0], &Xim[0], &Yre[0], &Yim[0]);
+        for(int i=0; i<N; ++i) {
+          complex<double>* Data = data[Indices[i]]+t0;
+          for(int tt=0; tt<nt; ++tt) {
+            Data[tt] = complex<double>(Yre[i*TimeBlock+tt], Yim[i*TimeBlock+tt]);
           }
         }
+      }
+    }
+  }
+
+  return *this;
+}
 
+#ifndef DOXYGEN
+namespace {
+  // Number of time steps processed together in the fused <L dt> and
+  // <LL> kernels.  Blocks of this many doubles (the independent
+  // components of <L dt> and <LL>) are accumulated over all modes and
+  // then used while they are still in cache.
+  const int LLTimeBlockSize = 256;
+
+  // The contribution of mode (ell,m) to <LL>.  Writing f=f^{\ell,m},
+  // and P_k = \bar{f}^{\ell,m+k} f, the terms of LLMatrix reduce to
+  //
+  //   LL^{xx} = cN |f|^2 + cP2 Re(P_2) + cM2 Re(P_{-2})
+  //   LL^{yy} = cN |f|^2 - cP2 Re(P_2) - cM2 Re(P_{-2})
+  //   LL^{xy} = cP2 Im(P_2) - cM2 Im(P_{-2})
+  //   LL^{xz} = cP1 Re(P_1) + cM1 Re(P_{-1})
+  //   LL^{yz} = cP1 Im(P_1) - cM1 Im(P_{-1})
+  //   LL^{zz} = cZ |f|^2
+  //
+  // where the coefficients are products of ladder-operator factors.
+  // Similarly, with \dot{P}_k = \bar{f}^{\ell,m+k} \dot{f},
+  //
+  //   <L dt>^x = Im(cLp \dot{P}_1 + cLm \dot{P}_{-1}) / 2
+  //   <L dt>^y = Re(cLm \dot{P}_{-1} - cLp \dot{P}_1) / 2
+  //   <L dt>^z = m Im(\dot{P}_0)
+  //
+  // Neighbors outside the ell multiplet have zero coefficients (and
+  // point at f itself, so they can be read harmlessly).
+  struct LLModeTerm {
+    const complex<double> *f, *fp1, *fp2, *fm1, *fm2;
+    double cN, cZ, cP1, cM1, cP2, cM2;
+    double cLp, cLm, m;
+  };
+
+  vector<LLModeTerm> LLModeTerms(const GWFrames::Waveform& W, const GWFrames::MatrixC& data, vector<int> Lmodes) {
+    const vector<vector<int> >& lm = W.LM();
+    if(Lmodes.size()==0) {
+      Lmodes.push_back(lm[0][0]);
+      for(unsigned int i_m=0; i_m<lm.size(); ++i_m) {
+        if(std::find(Lmodes.begin(), Lmodes.end(), lm[i_m][0]) == Lmodes.end() ) {
+          Lmodes.push_back(lm[i_m][0]);
+        }
+      }
+    }
+    vector<LLModeTerm> Terms;
+    for(unsigned int iL=0; iL<Lmodes.size(); ++iL) {
+      const int L = Lmodes[iL];
+      for(int M=-L; M<=L; ++M) {
+        const bool HasMm2 = (M-2>=-L), HasMm1 = (M-1>=-L), HasMp1 = (M+1<=L), HasMp2 = (M+2<=L);
+        LLModeTerm T;
+        T.f   = data[W.FindModeIndex(L,M)];
+        T.fm2 = (HasMm2 ? data[W.FindModeIndex(L,M-2)] : T.f);
+        T.fm1 = (HasMm1 ? data[W.FindModeIndex(L,M-1)] : T.f);
+        T.fp1 = (HasMp1 ? data[W.FindModeIndex(L,M+1)] : T.f);
+        T.fp2 = (HasMp2 ? data[W.FindModeIndex(L,M+2)] : T.f);
+        const double cLpLp = (HasMp2 ? LadderOperatorFactor(L, M+1)    * LadderOperatorFactor(L, M) : 0.0);
+        const double cLpLm = (HasMm1 ? LadderOperatorFactor(L, M-1)    * LadderOperatorFactor(L, -M) : 0.0);
+        const double cLmLp = (HasMp1 ? LadderOperatorFactor(L, -(M+1)) * LadderOperatorFactor(L, M) : 0.0);
+        const double cLmLm = (HasMm2 ? LadderOperatorFactor(L, -(M-1)) * LadderOperatorFactor(L, -M) : 0.0);
+        const double cLpLz = (HasMp1 ? LadderOperatorFactor(L, M) * double(M) : 0.0);
+        const double cLzLp = (HasMp1 ? double(M+1) * LadderOperatorFactor(L, M) : 0.0);
+        const double cLmLz = (HasMm1 ? LadderOperatorFactor(L, -M) * double(M) : 0.0);
+        const double cLzLm = (HasMm1 ? double(M-1) * LadderOperatorFactor(L, -M) : 0.0);
+        T.cN  = 0.25 * (cLpLm + cLmLp);
+        T.cZ  = double(M) * double(M);
+        T.cP1 = 0.25 * (cLpLz + cLzLp);
+        T.cM1 = 0.25 * (cLmLz + cLzLm);
+        T.cP2 = 0.25 * cLpLp;
+        T.cM2 = 0.25 * cLmLm;
+        T.cLp = (HasMp1 ? LadderOperatorFactor(L, M) : 0.0);
+        T.cLm = (HasMm1 ? LadderOperatorFactor(L, -M) : 0.0);
+        T.m = double(M);
+        Terms.push_back(T);
       }
+    }
+    return Terms;
+  }
+
+  // Add the contribution of one term to the independent components
+  // of <LL>, for the n time steps starting at i0.  LL holds six arrays
+  // of LLTimeBlockSize, in the order xx, xy, xz, yy, yz, zz.
+  inline void AccumulateLLTerm(const LLModeTerm& T, const int i0, const int n, double* LL) {
+    double* __restrict xx = LL;
+    double* __restrict xy = LL+LLTimeBlockSize;
+    double* __restrict xz = LL+2*LLTimeBlockSize;
+    double* __restrict yy = LL+3*LLTimeBlockSize;
+    double* __restrict yz = LL+4*LLTimeBlockSize;
+    double* __restrict zz = LL+5*LLTimeBlockSize;
+    const complex<double>* f = T.f+i0;
+    const complex<double>* fp1 = T.fp1+i0;
+    const complex<double>* fp2 = T.fp2+i0;
+    const complex<double>* fm1 = T.fm1+i0;
+    const complex<double>* fm2 = T.fm2+i0;
+    for(int i=0; i<n; ++i) {
+      const complex<double> P1 = conj(fp1[i]) * f[i];
+      const complex<double> P2 = conj(fp2[i]) * f[i];
+      const complex<double> M1 = conj(fm1[i]) * f[i];
+      const complex<double> M2 = conj(fm2[i]) * f[i];
+      const double N = std::norm(f[i]);
+      const double ReP2M2 = T.cP2*P2.real() + T.cM2*M2.real();
+      xx[i] += T.cN*N + ReP2M2;
+      yy[i] += T.cN*N - ReP2M2;
+      xy[i] += T.cP2*P2.imag() - T.cM2*M2.imag();
+      xz[i] += T.cP1*P1.real() + T.cM1*M1.real();
+      yz[i] += T.cP1*P1.imag() - T.cM1*M1.imag();
+      zz[i] += T.cZ*N;
+    }
+  }
 
-      mode += 2*l+1;
+  // Add the contribution of one term to <L dt>, given the time
+  // derivative fdot of that term's mode at the n time steps starting
+  // at i0.  Ldt holds three arrays of LLTimeBlockSize.
+  inline void AccumulateLdtTerm(const LLModeTerm& T, const complex<double>* fdot, const int i0, const int n, double* Ldt) {
+    double* __restrict lx = Ldt;
+    double* __restrict ly = Ldt+LLTimeBlockSize;
+    double* __restrict lz = Ldt+2*LLTimeBlockSize;
+    const complex<double>* f = T.f+i0;
+    const complex<double>* fp1 = T.fp1+i0;
+    const complex<double>* fm1 = T.fm1+i0;
+    for(int i=0; i<n; ++i) {
+      const complex<double> Lplus = T.cLp * conj(fp1[i]) * fdot[i];
+      const complex<double> Lminus = T.cLm * conj(fm1[i]) * fdot[i];
+      lx[i] += 0.5 * (Lplus.imag() + Lminus.imag());
+      ly[i] += 0.5 * (Lminus.real() - Lplus.real());
+      lz[i] += T.m * (conj(f[i]) * fdot[i]).imag();
     }
   }
 
-  return *this;
+  // Sum the independent components of <LL> over all terms, for the n
+  // time steps starting at i0
+  void AccumulateLLBlock(const vector<LLModeTerm>& Terms, const int i0, const int n, double* LL) {
+    std::fill(LL, LL+6*LLTimeBlockSize, 0.0);
+    for(unsigned int i_T=0; i_T<Terms.size(); ++i_T) {
+      AccumulateLLTerm(Terms[i_T], i0, n, LL);
+    }
+  }
+
+  // Unit eigenvector belonging to the largest eigenvalue of each of
+  // the n symmetric 3x3 matrices stored as in AccumulateLLBlock.
+  // The eigenvalue is found in closed form (the trigonometric
+  // solution of the characteristic cubic), and the eigenvector as the
+  // largest cross product of two rows of A-lambda*I.  The result is
+  // only defined up to sign, like that of DominantPrincipalAxis.
+  void DominantEigenvectorBlock(const double* LL, const int n, double* vx, double* vy, double* vz) {
+    const double* xx = LL;
+    const double* xy = LL+LLTimeBlockSize;
+    const double* xz = LL+2*LLTimeBlockSize;
+    const double* yy = LL+3*LLTimeBlockSize;
+    const double* yz = LL+4*LLTimeBlockSize;
+    const double* zz = LL+5*LLTimeBlockSize;
+    for(int i=0; i<n; ++i) {
+      // Scale to avoid overflow and underflow; the eigenvectors are unchanged
+      const double Scale = std::max(std::max(std::max(std::abs(xx[i]), std::abs(yy[i])), std::max(std::abs(zz[i]), std::abs(xy[i]))),
+                                    std::max(std::abs(xz[i]), std::abs(yz[i])));
+      const double InvScale = (Scale>0.0 ? 1.0/Scale : 0.0);
+      const double a00 = xx[i]*InvScale, a01 = xy[i]*InvScale, a02 = xz[i]*InvScale;
+      const double a11 = yy[i]*InvScale, a12 = yz[i]*InvScale, a22 = zz[i]*InvScale;
+
+      // Largest eigenvalue: with A = q I + p B, eig(B) = 2 cos(phi + 2 pi k/3)
+      const double q = (a00+a11+a22)/3.0;
+      const double b00 = a00-q, b11 = a11-q, b22 = a22-q;
+      const double p2 = (b00*b00 + b11*b11 + b22*b22 + 2.0*(a01*a01 + a02*a02 + a12*a12)) / 6.0;
+      const double p = std::sqrt(p2);
+      const double detB = b00*(b11*b22-a12*a12) - a01*(a01*b22-a12*a02) + a02*(a01*a12-b11*a02);
+      const double r = (p2>0.0 ? std::max(-1.0, std::min(1.0, 0.5*detB/(p2*p))) : 0.0);
+      const double lambda = q + 2.0*p*std::cos(std::acos(r)/3.0);
+
+      // Rows of A-lambda*I, and their pairwise cross products
+      const double r0x = a00-lambda, r0y = a01, r0z = a02;
+      const double r1x = a01, r1y = a11-lambda, r1z = a12;
+      const double r2x = a02, r2y = a12, r2z = a22-lambda;
+      const double c01x = r0y*r1z-r0z*r1y, c01y = r0z*r1x-r0x*r1z, c01z = r0x*r1y-r0y*r1x;
+      const double c02x = r0y*r2z-r0z*r2y, c02y = r0z*r2x-r0x*r2z, c02z = r0x*r2y-r0y*r2x;
+      const double c12x = r1y*r2z-r1z*r2y, c12y = r1z*r2x-r1x*r2z, c12z = r1x*r2y-r1y*r2x;
+      const double n01 = c01x*c01x+c01y*c01y+c01z*c01z;
+      const double n02 = c02x*c02x+c02y*c02y+c02z*c02z;
+      const double n12 = c12x*c12x+c12y*c12y+c12z*c12z;
+      double x, y, z, N;
+      if(n01>=n02 && n01>=n12) { x=c01x; y=c01y; z=c01z; N=n01; }
+      else if(n02>=n12) { x=c02x; y=c02y; z=c02z; N=n02; }
+      else { x=c12x; y=c12y; z=c12z; N=n12; }
+      if(N>0.0) {
+        const double InvNorm = 1.0/std::sqrt(N);
+        vx[i] = x*InvNorm;
+        vy[i] = y*InvNorm;
+        vz[i] = z*InvNorm;
+      } else { // A is a multiple of the identity; any direction will do
+        vx[i] = 0.0;
+        vy[i] = 0.0;
+        vz[i] = 1.0;
+      }
+    }
+  }
+  // Compute any of <L dt>, <LL> (as its six independent components),
+  // and the angular velocity omega (which solves -omega*<LL> = <L dt>)
+  // in one pass over blocks of time steps.  Null outputs are skipped,
+  // along with anything needed only for them.
+  void AngularMomentumSweep(const vector<LLModeTerm>& Terms, const vector<double>& t,
+                            vector<vector<double> >* Ldt, vector<vector<double> >* LL, vector<vector<double> >* Omega) {
+    const int ntimes = t.size();
+    const bool NeedLdt = (Ldt || Omega);
+    const bool NeedLL = (LL || Omega);
+    if(NeedLdt && ntimes<2) { // Checked here because ComplexDerivative can't throw from the parallel region
+      INFOTOCERR << "\nError: Need at least two time steps to differentiate; have " << ntimes << "." << std::endl;
+      throw(GWFrames_NotEnoughPointsForDerivative);
+    }
+    if(Ldt) { Ldt->assign(ntimes, vector<double>(3)); }
+    if(LL) { LL->assign(ntimes, vector<double>(6)); }
+    if(Omega) { Omega->assign(ntimes, vector<double>(3)); }
+    const int NBlocks = (ntimes+LLTimeBlockSize-1)/LLTimeBlockSize;
+    #pragma omp parallel if(ntimes>ParallelTimeThreshold)
+    {
+      vector<double> LLBlock(6*LLTimeBlockSize), LdtBlock(3*LLTimeBlockSize);
+      vector<complex<double> > fdot(LLTimeBlockSize);
+      #pragma omp for schedule(static)
+      for(int i_B=0; i_B<NBlocks; ++i_B) {
+        const int i0 = i_B*LLTimeBlockSize;
+        const int n = std::min(LLTimeBlockSize, ntimes-i0);
+        std::fill(LLBlock.begin(), LLBlock.end(), 0.0);
+        std::fill(LdtBlock.begin(), LdtBlock.end(), 0.0);
+        for(unsigned int i_T=0; i_T<Terms.size(); ++i_T) {
+          const LLModeTerm& T = Terms[i_T];
+          if(NeedLL) {
+            AccumulateLLTerm(T, i0, n, &LLBlock[0]);
+          }
+          if(NeedLdt) {
+            GWFrames::ComplexDerivative(T.f, &t[0], ntimes, i0, i0+n, &fdot[0]);
+            AccumulateLdtTerm(T, &fdot[0], i0, n, &LdtBlock[0]);
+          }
+        }
+        const double* lx = &LdtBlock[0];
+        const double* ly = &LdtBlock[LLTimeBlockSize];
+        const double* lz = &LdtBlock[2*LLTimeBlockSize];
+        const double* xx = &LLBlock[0];
+        const double* xy = &LLBlock[LLTimeBlockSize];
+        const double* xz = &LLBlock[2*LLTimeBlockSize];
+        const double* yy = &LLBlock[3*LLTimeBlockSize];
+        const double* yz = &LLBlock[4*LLTimeBlockSize];
+        const double* zz = &LLBlock[5*LLTimeBlockSize];
+        for(int i=0; i<n; ++i) {
+          if(Ldt) {
+            vector<double>& Ldt_i = (*Ldt)[i0+i];
+            Ldt_i[0] = lx[i];
+            Ldt_i[1] = ly[i];
+            Ldt_i[2] = lz[i];
+          }
+          if(LL) {
+            vector<double>& LL_i = (*LL)[i0+i];
+            LL_i[0] = xx[i];
+            LL_i[1] = xy[i];
+            LL_i[2] = xz[i];
+            LL_i[3] = yy[i];
+            LL_i[4] = yz[i];
+            LL_i[5] = zz[i];
+          }
+          if(Omega) {
+            // Cofactors of the symmetric matrix <LL>
+            const double c00 = yy[i]*zz[i]-yz[i]*yz[i];
+            const double c01 = xz[i]*yz[i]-xy[i]*zz[i];
+            const double c02 = xy[i]*yz[i]-xz[i]*yy[i];
+            const double c11 = xx[i]*zz[i]-xz[i]*xz[i];
+            const double c12 = xy[i]*xz[i]-xx[i]*yz[i];
+            const double c22 = xx[i]*yy[i]-xy[i]*xy[i];
+            const double MinusInvDet = -1.0/(xx[i]*c00 + xy[i]*c01 + xz[i]*c02);
+            vector<double>& Omega_i = (*Omega)[i0+i];
+            Omega_i[0] = MinusInvDet * (c00*lx[i] + c01*ly[i] + c02*lz[i]);
+            Omega_i[1] = MinusInvDet * (c01*lx[i] + c11*ly[i] + c12*lz[i]);
+            Omega_i[2] = MinusInvDet * (c02*lx[i] + c12*ly[i] + c22*lz[i]);
+          }
+        }
+      }
+    }
+  }
 }
+#endif // DOXYGEN
 
 /// Calculate the \f$<L \partial_t>\f$ quantity defined in the paper.
 vector<vector<double> > GWFrames::Waveform::LdtVector(vector<int> Lmodes) const {
@@ -1463,47 +1951,8 @@ vector<vector<double> > GWFrames::Waveform::LdtVector(vector<int> Lmodes) const
   // L- = Lx - i Ly      Ly = -i (L+ - L-) / 2     Im(Ly) = -( Re(L+) - Re(L-) ) / 2
   // Lz = Lz             Lz = Lz                   Im(Lz) = Im(Lz)
 
-  const LadderOperatorFactorSingleton& LadderOperatorFactor = LadderOperatorFactorSingleton::Instance();
-  if(Lmodes.size()==0) {
-    Lmodes.push_back(lm[0][0]);
-    for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-      if(std::find(Lmodes.begin(), Lmodes.end(), lm[i_m][0]) == Lmodes.end() ) {
-        Lmodes.push_back(lm[i_m][0]);
-      }
-    }
-  }
-  vector<vector<double> > l(NTimes(), vector<double>(3, 0.0));
-  for(unsigned int iL=0; iL<Lmodes.size(); ++iL) {
-    const int L = Lmodes[iL];
-    for(int M=-L; M<=L; ++M) {
-      const int iMode = FindModeIndex(L,M);
-      const vector<complex<double> > dDdt = DataDot(iMode);
-      if(M+1<=L) { // L+
-        const int iModep1 = FindModeIndex(L,M+1);
-        const double c_ell_posm = LadderOperatorFactor(L, M);
-        for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-          const complex<double> Lplus  = c_ell_posm * conj(data[iModep1][iTime]) * dDdt[iTime];
-          l[iTime][0] += 0.5 * imag(Lplus);
-          l[iTime][1] -= 0.5 * real(Lplus);
-        }
-      }
-      { // Lz; always evaluate this one
-        for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-          const complex<double> Lz = (conj(data[iMode][iTime]) * dDdt[iTime]) * double(M);
-          l[iTime][2] += imag(Lz);
-        }
-      }
-      if(M-1>=-L) { // L-
-        const int iModem1 = FindModeIndex(L,M-1);
-        const double c_ell_negm = LadderOperatorFactor(L, -M);
-        for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-          const complex<double> Lminus  = c_ell_negm * conj(data[iModem1][iTime]) * dDdt[iTime];
-          l[iTime][0] += 0.5 * imag(Lminus);
-          l[iTime][1] += 0.5 * real(Lminus);
-        }
-      }
-    }
-  }
+  vector<vector<double> > l;
+  AngularMomentumSweep(LLModeTerms(*this, data, Lmodes), t, &l, 0, 0);
   return l;
 }
 
@@ -1518,68 +1967,30 @@ vector<Matrix> GWFrames::Waveform::LLMatrix(vector<int> Lmodes) const {
   /// frame (X,Y,Z), rather than the inertial frame (x,y,z).
   ///
   /// \f$<LL>^{ab} = \sum_{\ell,m,m'} [\bar{f}^{\ell,m'} < \ell,m' | L_a L_b | \ell,m > f^{\ell,m} ]\f$
-
-  // Big, bad, ugly, obvious way to do the calculation
-
-  // L+ = Lx + i Ly      Lx =    (L+ + L-) / 2     Im(Lx) =  ( Im(L+) + Im(L-) ) / 2
-  // L- = Lx - i Ly      Ly = -i (L+ - L-) / 2     Im(Ly) = -( Re(L+) - Re(L-) ) / 2
-  // Lz = Lz             Lz = Lz                   Im(Lz) = Im(Lz)
-  // LxLx =   (L+ + L-)(L+ + L-) / 4
-  // LxLy = -i(L+ + L-)(L+ - L-) / 4
-  // LxLz =   (L+ + L-)(  Lz   ) / 2
-  // LyLx = -i(L+ - L-)(L+ + L-) / 4
-  // LyLy =  -(L+ - L-)(L+ - L-) / 4
-  // LyLz = -i(L+ - L-)(  Lz   ) / 2
-  // LzLx =   (  Lz   )(L+ + L-) / 2
-  // LzLy = -i(  Lz   )(L+ - L-) / 2
-  // LzLz =   (  Lz   )(  Lz   )
-  vector<Matrix> ll(NTimes(), Matrix(3,3));
-  const complex<double> ImaginaryI(0.0,1.0);
-  if(Lmodes.size()==0) {
-    Lmodes.push_back(lm[0][0]);
-    for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-      if(std::find(Lmodes.begin(), Lmodes.end(), lm[i_m][0]) == Lmodes.end() ) {
-        Lmodes.push_back(lm[i_m][0]);
-      }
-    }
-  }
-  for(unsigned int iL=0; iL<Lmodes.size(); ++iL) {
-    const int L = Lmodes[iL];
-    for(int M=-L; M<=L; ++M) {
-      const int iMm2 = (M-2>=-L ? FindModeIndex(L,M-2) : 0);
-      const int iMm1 = (M-1>=-L ? FindModeIndex(L,M-1) : 0);
-      const int iM   = FindModeIndex(L,M);
-      const int iMp1 = (M+1<=L ? FindModeIndex(L,M+1) : 0);
-      const int iMp2 = (M+2<=L ? FindModeIndex(L,M+2) : 0);
-      for(unsigned int iTime=0; iTime<NTimes(); ++iTime) {
-        const complex<double> LpLp = (M+2<=L  ? conj(data[iMp2][iTime]) * LadderOperatorFactor(L, M+1)    * LadderOperatorFactor(L, M) * data[iM][iTime] : 0.0);
-        const complex<double> LpLm = (M-1>=-L ? conj(data[iM][iTime])   * LadderOperatorFactor(L, M-1)    * LadderOperatorFactor(L, -M) * data[iM][iTime] : 0.0);
-        const complex<double> LmLp = (M+1<=L  ? conj(data[iM][iTime])   * LadderOperatorFactor(L, -(M+1)) * LadderOperatorFactor(L, M) * data[iM][iTime] : 0.0);
-        const complex<double> LmLm = (M-2>=-L ? conj(data[iMm2][iTime]) * LadderOperatorFactor(L, -(M-1)) * LadderOperatorFactor(L, -M) * data[iM][iTime] : 0.0);
-        const complex<double> LpLz = (M+1<=L  ? conj(data[iMp1][iTime]) * LadderOperatorFactor(L, M) * double(M)      * data[iM][iTime] : 0.0);
-        const complex<double> LzLp = (M+1<=L  ? conj(data[iMp1][iTime]) * double(M+1) * LadderOperatorFactor(L, M)  * data[iM][iTime] : 0.0);
-        const complex<double> LmLz = (M-1>=-L ? conj(data[iMm1][iTime]) * LadderOperatorFactor(L, -M) * double(M)     * data[iM][iTime] : 0.0);
-        const complex<double> LzLm = (M-1>=-L ? conj(data[iMm1][iTime]) * double(M-1) * LadderOperatorFactor(L, -M) * data[iM][iTime] : 0.0);
-        const complex<double> LzLz = conj(data[iM][iTime]) * double(M) * double(M) * data[iM][iTime];
-        //
-        const complex<double> LxLx = 0.25 * (LpLp + LmLm + LmLp + LpLm);
-        const complex<double> LxLy = -0.25 * ImaginaryI * (LpLp - LmLm + LmLp - LpLm);
-        const complex<double> LxLz = 0.5 * (LpLz + LmLz);
-        const complex<double> LyLx = -0.25 * ImaginaryI * (LpLp - LmLp + LpLm - LmLm);
-        const complex<double> LyLy = -0.25 * (LpLp - LmLp - LpLm + LmLm);
-        const complex<double> LyLz = -0.5 * ImaginaryI * (LpLz - LmLz);
-        const complex<double> LzLx = 0.5 * (LzLp + LzLm);
-        const complex<double> LzLy = -0.5 * ImaginaryI * (LzLp - LzLm);
-        //const complex<double> LzLz = (LzLz);
-        ll[iTime](0,0) += real( LxLx );
-        ll[iTime](0,1) += real( LxLy + LyLx )/2.0;
-        ll[iTime](0,2) += real( LxLz + LzLx )/2.0;
-        ll[iTime](1,0) += real( LyLx + LxLy )/2.0;
-        ll[iTime](1,1) += real( LyLy );
-        ll[iTime](1,2) += real( LyLz + LzLy )/2.0;
-        ll[iTime](2,0) += real( LzLx + LxLz )/2.0;
-        ll[iTime](2,1) += real( LzLy + LyLz )/2.0;
-        ll[iTime](2,2) += real( LzLz );
+  ///
+  /// The matrix is symmetric, so only its six independent components
+  /// are actually computed (see AccumulateLLBlock).
+
+  const vector<LLModeTerm> Terms = LLModeTerms(*this, data, Lmodes);
+  const int ntimes = NTimes();
+  vector<Matrix> ll(ntimes, Matrix(3,3));
+  const int NBlocks = (ntimes+LLTimeBlockSize-1)/LLTimeBlockSize;
+  #pragma omp parallel if(ntimes>ParallelTimeThreshold)
+  {
+    vector<double> LL(6*LLTimeBlockSize);
+    #pragma omp for schedule(static)
+    for(int i_B=0; i_B<NBlocks; ++i_B) {
+      const int i0 = i_B*LLTimeBlockSize;
+      const int n = std::min(LLTimeBlockSize, ntimes-i0);
+      AccumulateLLBlock(Terms, i0, n, &LL[0]);
+      for(int i=0; i<n; ++i) {
+        Matrix& ll_i = ll[i0+i];
+        ll_i(0,0) = LL[i];
+        ll_i(0,1) = ll_i(1,0) = LL[LLTimeBlockSize+i];
+        ll_i(0,2) = ll_i(2,0) = LL[2*LLTimeBlockSize+i];
+        ll_i(1,1) = LL[3*LLTimeBlockSize+i];
+        ll_i(1,2) = ll_i(2,1) = LL[4*LLTimeBlockSize+i];
+        ll_i(2,2) = LL[5*LLTimeBlockSize+i];
       }
     }
   }
@@ -1607,13 +2018,27 @@ std::vector<std::vector<double> > GWFrames::Waveform::LLDominantEigenvector(cons
   /// The vector is given in the (possibly rotating) mode frame
   /// (X,Y,Z), rather than the inertial frame (x,y,z).
 
-  // Calculate the LL matrix at each instant
-  vector<Matrix> ll = LLMatrix(Lmodes);
-
-  // Calculate the dominant principal axis (dpa) of LL at each instant
-  vector<vector<double> > dpa(NTimes(), vector<double>(3));
-  for(unsigned int i=0; i<ll.size(); ++i) {
-    dpa[i] = GWFrames::DominantPrincipalAxis(ll[i]);
+  // Calculate the LL matrix and its dominant principal axis (dpa)
+  // one block of instants at a time, without storing LL
+  const vector<LLModeTerm> Terms = LLModeTerms(*this, data, Lmodes);
+  const int ntimes = NTimes();
+  vector<vector<double> > dpa(ntimes, vector<double>(3));
+  const int NBlocks = (ntimes+LLTimeBlockSize-1)/LLTimeBlockSize;
+  #pragma omp parallel if(ntimes>ParallelTimeThreshold)
+  {
+    vector<double> LL(6*LLTimeBlockSize), V(3*LLTimeBlockSize);
+    #pragma omp for schedule(static)
+    for(int i_B=0; i_B<NBlocks; ++i_B) {
+      const int i0 = i_B*LLTimeBlockSize;
+      const int n = std::min(LLTimeBlockSize, ntimes-i0);
+      AccumulateLLBlock(Terms, i0, n, &LL[0]);
+      DominantEigenvectorBlock(&LL[0], n, &V[0], &V[LLTimeBlockSize], &V[2*LLTimeBlockSize]);
+      for(int i=0; i<n; ++i) {
+        dpa[i0+i][0] = V[i];
+        dpa[i0+i][1] = V[LLTimeBlockSize+i];
+        dpa[i0+i][2] = V[2*LLTimeBlockSize+i];
+      }
+    }
   }
 
   // Make the initial direction closer to RoughInitialEllDirection than not
@@ -1675,36 +2100,30 @@ vector<vector<double> > GWFrames::Waveform::AngularVelocityVector(const vector<i
   /// the sum.
   ///
 
-  // Calculate the L vector and LL matrix at each instant
-  vector<vector<double> > l = LdtVector(Lmodes);
-  vector<Matrix> ll = LLMatrix(Lmodes);
-
-  // Construct some objects for storage
-  vector<vector<double> > omega(NTimes(), vector<double>(3));
-  int s;
-  gsl_vector* x = gsl_vector_alloc(3);
-  gsl_permutation* p = gsl_permutation_alloc(3);
-
-  // Loop through time steps
-  for(unsigned int iTime=0; iTime<omega.size(); ++iTime) {
-    // Solve   -omega * LL = L   at each time step, using LU decomposition
-    gsl_vector_view b = gsl_vector_view_array(&l[iTime][0], 3);
-    gsl_linalg_LU_decomp(ll[iTime].gslobj(), p, &s);
-    gsl_linalg_LU_solve(ll[iTime].gslobj(), p, &b.vector, x);
-
-    // Save data for this time step
-    omega[iTime][0] = -gsl_vector_get(x, 0);
-    omega[iTime][1] = -gsl_vector_get(x, 1);
-    omega[iTime][2] = -gsl_vector_get(x, 2);
-  }
-
-  // Free the memory
-  gsl_permutation_free(p);
-  gsl_vector_free(x);
-
+  // Solve   -omega * LL = L   at each instant, computing L and LL
+  // only as needed, one block of instants at a time
+  vector<vector<double> > omega;
+  AngularMomentumSweep(LLModeTerms(*this, data, Lmodes), t, 0, 0, &omega);
   return omega;
 }
 
+/// Calculate the angular velocity of the Waveform, along with <L dt> and <LL>.
+GWFrames::AngularVelocityDiagnostics GWFrames::Waveform::AngularVelocityWithDiagnostics(const vector<int>& Lmodes) const {
+  ///
+  /// \param Lmodes L modes to evaluate
+  ///
+  /// This returns the same quantities as `LdtVector`, `LLMatrix`, and
+  /// `AngularVelocityVector`, but computes them all in a single pass
+  /// over the data.  The <LL> matrix is symmetric, so only its six
+  /// independent components are returned, in the order (xx, xy, xz,
+  /// yy, yz, zz).
+  ///
+  /// \sa AngularVelocityVector
+  AngularVelocityDiagnostics Diagnostics;
+  AngularMomentumSweep(LLModeTerms(*this, data, Lmodes), t, &Diagnostics.Ldt, &Diagnostics.LL, &Diagnostics.Omega);
+  return Diagnostics;
+}
+
 /// Calculate the angular velocity of the Waveform.
 vector<vector<double> > GWFrames::Waveform::AngularVelocityVectorRelativeToInertial(const vector<int>& Lmodes) const {
   ///
@@ -1901,23 +2320,176 @@ GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& Ne
   /// time data.  If false, and such times are requested, an error
   /// will be thrown.
   ///
+  /// To interpolate the same Waveform repeatedly, construct a
+  /// `WaveformSpline` once and use its `Interpolate` method.
+  ///
+  return WaveformSpline(*this).Interpolate(NewTime, AllowTimesOutsideCurrentDomain);
+}
+
+/// Interpolate the Waveform to a new set of time instants by local polynomials.
+GWFrames::Waveform GWFrames::Waveform::InterpolateLocal(const std::vector<double>& NewTime, const unsigned int Order, const bool AllowTimesOutsideCurrentDomain) const {
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param Order Degree of the interpolating polynomials [Default: 5]
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  ///
+  /// Each mode is interpolated by the Lagrange polynomial through the
+  /// `Order+1` data points nearest to each new time.  Unlike the
+  /// cubic spline used by `Interpolate`, this needs no global solve,
+  /// and is fastest when the current times are uniformly spaced.  For
+  /// smooth data sampled finely enough, `Order=5` or `7` is typically
+  /// more accurate than the spline; `Order=3` is cheaper but less
+  /// accurate.  Times outside the current domain are treated as in
+  /// `Interpolate`.
+  ///
+  /// To interpolate the same Waveform repeatedly, construct a
+  /// `WaveformLocalInterpolant` once and use its `Interpolate`
+  /// method.
+  ///
+  return WaveformLocalInterpolant(*this, Order).Interpolate(NewTime, AllowTimesOutsideCurrentDomain);
+}
+
+/// Select a subset of the time steps from which the Waveform can be interpolated to within a tolerance
+GWFrames::Waveform GWFrames::Waveform::Compress(const double Tolerance) const {
+  /// \param Tolerance Allowed error, relative to the peak norm [Default: 1e-6]
+  ///
+  /// The returned Waveform holds the data of this one at a subset of
+  /// its time steps, chosen so that interpolating it back to the
+  /// original times with `Interpolate` reproduces the data to within
+  /// the tolerance.  The error at each time is measured as the L2
+  /// norm over all modes, and is compared to `Tolerance` times the
+  /// peak of the same norm of the data.  If the frame is given at
+  /// each time step, the interpolated frame's error (scaled by the
+  /// data's norm and the largest \f$\ell\f$) is included too.
+  ///
+  /// The time steps are chosen greedily: starting from a coarse
+  /// uniform subset including the endpoints, each pass interpolates
+  /// the current subset to all the original times and adds the time
+  /// step with the largest error in each interval whose error is too
+  /// large.  The first and last time steps are always kept.
+  ///
+  /// Since `Interpolate` uses cubic splines in the real and
+  /// imaginary parts, this keeps at least a few times per cycle of
+  /// the fastest mode, but typically far fewer than the output
+  /// cadence of a numerical simulation during the inspiral.
+  ///
+  const unsigned int N = NTimes();
+  const unsigned int NModes = this->NModes();
+  if(N<3 || NModes==0) { return *this; }
+  if(frame.size()>1 && frame.size()!=N) {
+    INFOTOCERR << " I don't understand what to do with frame data of length " << frame.size() << " in a Waveform with " << N << " times." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  // Find the norm at each time, and the absolute tolerance
+  std::vector<double> Norm(N, 0.0);
+  for(unsigned int i_m=0; i_m<NModes; ++i_m) {
+    for(unsigned int i=0; i<N; ++i) {
+      Norm[i] += std::norm(data[i_m][i]);
+    }
+  }
+  double MaxNorm = 0.0;
+  for(unsigned int i=0; i<N; ++i) {
+    Norm[i] = std::sqrt(Norm[i]);
+    MaxNorm = std::max(MaxNorm, Norm[i]);
+  }
+  const double AbsoluteTolerance = Tolerance*MaxNorm;
+  const double FrameErrorScale = 2.0*std::max(EllMax(), 1);
+
+  // Begin with a coarse uniform subset
+  const unsigned int NInitial = std::min(N, 17u);
+  std::vector<unsigned int> Indices(NInitial);
+  for(unsigned int i=0; i<NInitial; ++i) {
+    Indices[i] = (unsigned long long)(i)*(N-1)/(NInitial-1);
+  }
+
+  std::vector<double> Error(N);
+  while(true) {
+    const Waveform Subset = SubsetOfTimeIndices(Indices);
+    // Evaluate the error at every original time
+    std::fill(Error.begin(), Error.end(), 0.0);
+    {
+      const WaveformSpline Spline(Subset);
+      const WaveformSpline::Stencil S = Spline.StencilAt(t);
+      #pragma omp parallel if(NModes>1 && N>ParallelTimeThreshold)
+      {
+        std::vector<complex<double> > Row(N);
+        std::vector<double> ThreadError(N, 0.0);
+        #pragma omp for schedule(static)
+        for(int i_m=0; i_m<int(NModes); ++i_m) {
+          Spline.EvaluateMode(i_m, S, &Row[0]);
+          for(unsigned int i=0; i<N; ++i) {
+            ThreadError[i] += std::norm(Row[i]-data[i_m][i]);
+          }
+        }
+        #pragma omp critical(CompressError)
+        {
+          for(unsigned int i=0; i<N; ++i) {
+            Error[i] += ThreadError[i];
+          }
+        }
+      }
+    }
+    for(unsigned int i=0; i<N; ++i) {
+      Error[i] = std::sqrt(Error[i]);
+    }
+    if(frame.size()>1) {
+      const std::vector<Quaternion> Frame = Quaternions::Squad(Subset.frame, Subset.t, t);
+      for(unsigned int i=0; i<N; ++i) {
+        Error[i] += FrameErrorScale * Norm[i] * Quaternions::abs(Quaternions::logRotor(Frame[i]*Quaternions::inverse(frame[i])));
+      }
+    }
+    // Add the worst time step in each interval with too large an error
+    std::vector<unsigned int> NewIndices;
+    NewIndices.reserve(2*Indices.size());
+    for(unsigned int k=0; k+1<Indices.size(); ++k) {
+      NewIndices.push_back(Indices[k]);
+      unsigned int i_max = Indices[k]+1;
+      for(unsigned int i=Indices[k]+2; i<Indices[k+1]; ++i) {
+        if(Error[i]>Error[i_max]) { i_max = i; }
+      }
+      if(i_max<Indices[k+1] && Error[i_max]>AbsoluteTolerance) {
+        NewIndices.push_back(i_max);
+      }
+    }
+    NewIndices.push_back(Indices.back());
+    if(NewIndices.size()==Indices.size()) { break; }
+    Indices.swap(NewIndices);
+  }
+
+  Waveform C = SubsetOfTimeIndices(Indices);
+  C.history.str(HistoryStr());
+  C.history.clear();
+  C.history.seekp(0, ios_base::end);
+  C.history << "### *this = this->Compress(" << Tolerance << "); // " << Indices.size() << " of " << N << " time steps" << std::endl;
+  return C;
+}
+
+/// Check the new times, and set up a Waveform with this one's metadata and frame at those times
+GWFrames::Waveform GWFrames::Waveform::InterpolationTarget(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain,
+                                                           const std::string& Call, unsigned int& i0, unsigned int& i1) const {
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param AllowTimesOutsideCurrentDomain If false, throw when times are outside the current domain
+  /// \param Call Text describing the interpolation, for the history
+  /// \param i0 On output, the first index in `NewTime` inside the current domain
+  /// \param i1 On output, one beyond the last index in `NewTime` inside the current domain
+  ///
+  /// The returned Waveform has the modes and metadata of this one,
+  /// the frame interpolated to `NewTime`, and data of the right size
+  /// for the caller to fill in.
+  ///
   if(NewTime.size()==0) {
     INFOTOCERR << ": Asking for empty Waveform." << std::endl;
     throw(GWFrames_EmptyIntersection);
   }
-  unsigned int i0=0, i1=NewTime.size()-1;
   const unsigned int i2 = NewTime.size();
-  vector<double> NewTimesInsideCurrentDomain;
+  i0 = 0;
+  i1 = i2;
   if(AllowTimesOutsideCurrentDomain) {
-    // Set the indices in the dumbest way possible
-    while(NewTime[i0]<t[0]) { ++i0; }
-    while(NewTime[i1]>t.back() && i1>0) { --i1; }
-    ++i1;
+    while(i0<i2 && NewTime[i0]<t[0]) { ++i0; }
+    while(i1>i0 && NewTime[i1-1]>t.back()) { --i1; }
     // Now, i0 is the first index in NewTime for which a current time
     // exists, and i1 is 1 beyond the last index in NewTime for which
     // a current time exists.
-    NewTimesInsideCurrentDomain.resize(i1-i0);
-    std::copy(NewTime.begin()+i0, NewTime.begin()+i1, NewTimesInsideCurrentDomain.begin());
   } else {
     if(NewTime[0]<t[0]) {
       std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Asking for extrapolation; we only do interpolation.\n"
@@ -1934,24 +2506,25 @@ GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& Ne
   }
 
   Waveform C;
-  C.spinweight = this->spinweight;
+  C.spinweight = spinweight;
+  C.boostweight = boostweight;
   C.history << HistoryStr()
-            << "### *this = this->Interpolate(NewTime," << AllowTimesOutsideCurrentDomain << ");" << std::endl;
+            << "### *this = this->" << Call << ";" << std::endl;
   C.t = NewTime;
   if(frame.size()==1) { // Assume we have just a constant non-trivial frame
     C.frame = frame;
   } else if(frame.size()>1) { // Assume we have frame data for each time step
-    if(AllowTimesOutsideCurrentDomain) {
-      C.frame.resize(NewTime.size());
-      const std::vector<Quaternion> NewFrame = Squad(frame, t, NewTimesInsideCurrentDomain);
-      for(unsigned int i=0; i<i0; ++i) {
-        C.frame[i] = NewFrame[0];
-      }
-      for(unsigned int i=i0; i<i1; ++i) {
-        C.frame[i] = NewFrame[i-i0];
-      }
-      for(unsigned int i=i1; i<i2; ++i) {
-        C.frame[i] = NewFrame.back();
+    if(i0>0 || i1<i2) {
+      C.frame.resize(i2);
+      if(i1>i0) {
+        const std::vector<double> NewTimesInsideCurrentDomain(NewTime.begin()+i0, NewTime.begin()+i1);
+        const std::vector<Quaternion> NewFrame = Squad(frame, t, NewTimesInsideCurrentDomain);
+        std::fill(C.frame.begin(), C.frame.begin()+i0, NewFrame[0]);
+        std::copy(NewFrame.begin(), NewFrame.end(), C.frame.begin()+i0);
+        std::fill(C.frame.begin()+i1, C.frame.end(), NewFrame.back());
+      } else {
+        std::fill(C.frame.begin(), C.frame.begin()+i0, frame[0]);
+        std::fill(C.frame.begin()+i0, C.frame.end(), frame.back());
       }
     } else {
       C.frame = Squad(frame, t, NewTime);
@@ -1962,44 +2535,8 @@ GWFrames::Waveform GWFrames::Waveform::Interpolate(const std::vector<double>& Ne
   C.rIsScaledOut = rIsScaledOut;
   C.mIsScaledOut = mIsScaledOut;
   C.lm = lm;
+  C.lmIndex = lmIndex;
   C.data.resize(NModes(), NewTime.size());
-  // Initialize the GSL interpolators for the data
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, NTimes());
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, NTimes());
-  // Now loop over each mode filling in the waveform data
-  for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> re = Re(i_m);
-    const vector<double> im = Im(i_m);
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineRe, &(t)[0], &re[0], NTimes());
-    gsl_spline_init(splineIm, &(t)[0], &im[0], NTimes());
-    // Assign the interpolated data
-    if(AllowTimesOutsideCurrentDomain) {
-      for(unsigned int i_t=0; i_t<i0; ++i_t) {
-        C.data[i_m][i_t] = complex<double>( 0., 0. );
-      }
-      for(unsigned int i_t=i0; i_t<i1; ++i_t) {
-        C.data[i_m][i_t] = complex<double>( gsl_spline_eval(splineRe, NewTimesInsideCurrentDomain[i_t], accRe),
-                                            gsl_spline_eval(splineIm, NewTimesInsideCurrentDomain[i_t], accIm) );
-      }
-      for(unsigned int i_t=i1; i_t<i2; ++i_t) {
-        C.data[i_m][i_t] = complex<double>( 0., 0. );
-      }
-    } else {
-      for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
-        C.data[i_m][i_t] = complex<double>( gsl_spline_eval(splineRe, C.t[i_t], accRe), gsl_spline_eval(splineIm, C.t[i_t], accIm) );
-      }
-    }
-  }
-  // Free the interpolators
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
-
   return C;
 }
 
@@ -2022,106 +2559,550 @@ GWFrames::Waveform& GWFrames::Waveform::InterpolateInPlace(const std::vector<dou
 
   history << HistoryStr()
           << "*this = this->Interpolate(NewTime);" << std::endl;
-  const vector<double> OldTime(t);
-  if(frame.size()==1) { // Assume we have just a constant non-trivial frame
-    frame = frame;
-  } else if(frame.size()>1) { // Assume we have frame data for each time step
-    frame = Squad(frame, OldTime, NewTime);
-  }
-  MatrixC NewData;
-  NewData.resize(NModes(), NewTime.size());
-  // Initialize the GSL interpolators for the data
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, OldTime.size());
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, OldTime.size());
-  // Now loop over each mode filling in the waveform data
-  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> re(Re(i_m));
-    const vector<double> im(Im(i_m));
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineRe, &(OldTime)[0], &re[0], OldTime.size());
-    gsl_spline_init(splineIm, &(OldTime)[0], &im[0], OldTime.size());
-    // Assign the interpolated data
-    for(unsigned int i_t=0; i_t<NewTime.size(); ++i_t) {
-      NewData[i_m][i_t] = complex<double>( gsl_spline_eval(splineRe, NewTime[i_t], accRe), gsl_spline_eval(splineIm, NewTime[i_t], accIm) );
-    }
-  }
-  data.swap(NewData);
+  {
+    const WaveformSpline Spline(*this);
+    const WaveformSpline::Stencil S = Spline.StencilAt(NewTime);
+    MatrixC NewData(NModes(), NewTime.size());
+    #pragma omp parallel for if(NModes()>1 && NewTime.size()>ParallelTimeThreshold)
+    for(int i_m=0; i_m<int(NModes()); ++i_m) {
+      Spline.EvaluateMode(i_m, S, NewData[i_m]);
+    }
+    if(frame.size()>1) { // Assume we have frame data for each time step
+      frame = Squad(frame, t, NewTime);
+    }
+    data.swap(NewData);
+  }
   t = NewTime;
-  // Free the interpolators
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
 
   return *this;
 }
 
-/// Find the appropriate rotations to fix the attitude of the corotating frame.
-std::vector<Quaternions::Quaternion> GWFrames::Waveform::GetAlignmentsOfDecompositionFrameToModes(const std::vector<int>& Lmodes) const {
-  ///
-  /// \param Lmodes Lmodes to use in computing \f$<LL>\f$
-  ///
-  /// This function finds the appropriate pre-multiplied rotation
-  /// \f$R_{\varepsilon}\f$ so that the decomposition frame is aligned
-  /// to the waveform.  This particular version finds the appropriate
-  /// \f$R_{\varepsilon}\f$ at each time in the input Waveform.  This
-  /// is useful in cases where we need to try many such alignments,
-  /// because the setup for interpolation is very slow.
+/// Construct the spline for each mode of the input Waveform
+GWFrames::WaveformSpline::WaveformSpline(const GWFrames::Waveform& iW)
+  : W(iW), y2()
+{
+  /// \param iW Waveform to interpolate, which must outlive this object
   ///
-  /// Note that this function has no option to choose the direction of
-  /// X based on some nHat vector, as other similar functions have.
-  /// That issue is assumed to be handled elsewhere.
+  /// The natural cubic spline through the points \f$(t_i, y_i)\f$
+  /// has second derivatives \f$y''_i\f$ satisfying a tridiagonal
+  /// system whose matrix depends only on the times, with
+  /// \f$y''_0=y''_{n-1}=0\f$.  So we factor that matrix just once,
+  /// then solve for all modes with the same factors.
+  const vector<double>& t = W.t;
+  const int n = t.size();
+  const int NModes = W.NModes();
+  if(n<2) {
+    INFOTOCERR << "\nError: Cannot construct a spline from " << n << " time steps." << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+  y2.resize(NModes, n); // Initialized to zero, as needed for the natural boundary conditions
+  if(n<3) { return; } // The spline is linear
 
-  if(frameType!=GWFrames::Coprecessing && frameType!=GWFrames::Coorbital && frameType!=GWFrames::Corotating) {
-    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
-              << "\nError: GetAlignmentsOfDecompositionFrameToModes only takes Waveforms in the "
-              << GWFrames::WaveformFrameNames[GWFrames::Coprecessing] << ", "
-              << GWFrames::WaveformFrameNames[GWFrames::Coorbital] << ", or "
-              << GWFrames::WaveformFrameNames[GWFrames::Corotating] << " frames."
-              << "\n       This Waveform is in the " << GWFrames::WaveformFrameNames[frameType] << " frame." << std::endl;
-    throw(GWFrames_WrongFrameType);
+  // Thomas algorithm: eliminate the subdiagonal, storing the
+  // modified diagonal (inverted) and the step sizes
+  vector<double> h(n-1), InvDiag(n-1);
+  for(int i=0; i<n-1; ++i) {
+    h[i] = t[i+1]-t[i];
+  }
+  InvDiag[1] = 1.0/(2*(h[0]+h[1]));
+  for(int i=2; i<n-1; ++i) {
+    InvDiag[i] = 1.0/(2*(h[i-1]+h[i]) - h[i-1]*h[i-1]*InvDiag[i-1]);
   }
 
-  if(frame.size()!=NTimes()) {
-    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
-              << "\nError: GetAlignmentsOfDecompositionFrameToModes requires full information about the Waveform's frame."
-              << "\n       This Waveform has " << NTimes() << " time steps, but " << frame.size() << " rotors in its frame data." << std::endl;
-    throw(GWFrames_VectorSizeMismatch);
+  #pragma omp parallel for if(NModes>1 && n>ParallelTimeThreshold)
+  for(int i_m=0; i_m<NModes; ++i_m) {
+    const complex<double>* y = W.data[i_m];
+    complex<double>* z = y2[i_m];
+    // Forward elimination
+    z[1] = 6.0*((y[2]-y[1])/h[1] - (y[1]-y[0])/h[0]);
+    for(int i=2; i<n-1; ++i) {
+      z[i] = 6.0*((y[i+1]-y[i])/h[i] - (y[i]-y[i-1])/h[i-1]) - h[i-1]*InvDiag[i-1]*z[i-1];
+    }
+    // Back substitution
+    z[n-2] *= InvDiag[n-2];
+    for(int i=n-3; i>0; --i) {
+      z[i] = (z[i] - h[i]*z[i+1]) * InvDiag[i];
+    }
   }
+}
 
-  // This will be the returned quantity
-  std::vector<Quaternion> R_eps(NTimes());
+/// Find the interval indices and weights needed to evaluate the spline at the given times
+GWFrames::WaveformSpline::Stencil GWFrames::WaveformSpline::StencilAt(const std::vector<double>& NewTime) const {
+  return StencilAt((NewTime.size()>0 ? &NewTime[0] : 0), NewTime.size());
+}
 
-  // Get direction of angular-velocity vector at each time step, in this frame
-  const vector<Quaternion> omegaHat
-    = Quaternions::inverse(frame)
-    * Quaternions::normalized(Quaternions::QuaternionArray(this->AngularVelocityVectorRelativeToInertial())) * frame;
+/// Find the interval indices and weights needed to evaluate the spline at the given times
+GWFrames::WaveformSpline::Stencil GWFrames::WaveformSpline::StencilAt(const double* NewTime, const unsigned int N) const {
+  /// \param NewTime Pointer to the times at which to evaluate
+  /// \param N Number of times
+  ///
+  /// The value at time \f$t\f$ in the interval \f$[t_j, t_{j+1}]\f$
+  /// is
+  /// \f[ A\, y_j + B\, y_{j+1} + C\, y''_j + D\, y''_{j+1}, \f]
+  /// where the weights depend only on the times.  They are found
+  /// here once, and can then be used for every mode.  The search for
+  /// each interval begins where the last one ended, so this is
+  /// linear in the number of times when `NewTime` is sorted.  Times
+  /// outside the domain of the data are extrapolated from the first
+  /// or last interval; it is up to the caller to check for those.
+  const vector<double>& t = W.t;
+  const unsigned int n = t.size();
+  Stencil S;
+  S.Index.resize(N);
+  S.A.resize(N);
+  S.B.resize(N);
+  S.C.resize(N);
+  S.D.resize(N);
+  unsigned int j=0;
+  for(unsigned int i=0; i<N; ++i) {
+    const double x = NewTime[i];
+    if(x<t[j]) {
+      j = std::upper_bound(t.begin(), t.end(), x) - t.begin();
+      j = (j>0 ? j-1 : 0);
+    }
+    while(j+2<n && t[j+1]<x) { ++j; }
+    const double h = t[j+1]-t[j];
+    const double B = (x-t[j])/h;
+    const double A = 1.0-B;
+    S.Index[i] = j;
+    S.A[i] = A;
+    S.B[i] = B;
+    S.C[i] = (A*A*A-A)*h*h/6.0;
+    S.D[i] = (B*B*B-B)*h*h/6.0;
+  }
+  return S;
+}
 
-  const vector<vector<double> > V_h = this->LLDominantEigenvector(Lmodes);
+/// Evaluate one mode of the spline using precomputed weights
+void GWFrames::WaveformSpline::EvaluateMode(const unsigned int Mode, const Stencil& S, std::complex<double>* Out) const {
+  /// \param Mode Index of the mode to evaluate
+  /// \param S Stencil returned by `StencilAt`
+  /// \param Out Pointer to storage for `S.size()` values
+  ///
+  /// This does not allocate, and may be called for different modes
+  /// from different threads.
+  const complex<double>* y = W.data[Mode];
+  const complex<double>* z = y2[Mode];
+  const unsigned int N = S.size();
+  const unsigned int* Index = S.Index.empty() ? 0 : &S.Index[0];
+  const double* A = S.A.empty() ? 0 : &S.A[0];
+  const double* B = S.B.empty() ? 0 : &S.B[0];
+  const double* C = S.C.empty() ? 0 : &S.C[0];
+  const double* D = S.D.empty() ? 0 : &S.D[0];
+  for(unsigned int i=0; i<N; ++i) {
+    const unsigned int j = Index[i];
+    Out[i] = A[i]*y[j] + B[i]*y[j+1] + C[i]*z[j] + D[i]*z[j+1];
+  }
+}
+
+/// Interpolate the Waveform to a new set of time instants
+GWFrames::Waveform GWFrames::WaveformSpline::Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain) const {
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  ///
+  /// If `AllowTimesOutsideCurrentDomain` is true, the values of all
+  /// modes will be set to 0.0 for times outside the current set of
+  /// time data.  If false, and such times are requested, an error
+  /// will be thrown.
+  ///
+  /// The result is the same as `W.Interpolate(NewTime,
+  /// AllowTimesOutsideCurrentDomain)`.
+  ///
+  std::stringstream Call;
+  Call << "Interpolate(NewTime," << AllowTimesOutsideCurrentDomain << ")";
+  unsigned int i0, i1;
+  Waveform C = W.InterpolationTarget(NewTime, AllowTimesOutsideCurrentDomain, Call.str(), i0, i1);
+  const unsigned int NModes = C.NModes();
+  const unsigned int i2 = NewTime.size();
+  // Evaluate the splines for each mode, sharing the interval search
+  // and weights among all modes
+  const Stencil S = StencilAt(&NewTime[0]+i0, i1-i0);
+  #pragma omp parallel for if(NModes>1 && NewTime.size()>ParallelTimeThreshold)
+  for(int i_m=0; i_m<int(NModes); ++i_m) {
+    std::fill(C.data[i_m], C.data[i_m]+i0, complex<double>(0., 0.));
+    EvaluateMode(i_m, S, C.data[i_m]+i0);
+    std::fill(C.data[i_m]+i1, C.data[i_m]+i2, complex<double>(0., 0.));
+  }
 
-  const unsigned int i_22 = FindModeIndex(2,2);
-  const unsigned int i_2m2 = FindModeIndex(2,-2);
+  return C;
+}
 
-  for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    // Choose the normalized eigenvector more parallel to omegaHat than anti-parallel
-    const Quaternion V_hi = (omegaHat[i_t].dot(V_h[i_t]) < 0 ? -Quaternions::normalized(V_h[i_t]) : Quaternions::normalized(V_h[i_t]));
+/// Construct the local interpolant, precomputing what depends only on the times
+GWFrames::WaveformLocalInterpolant::WaveformLocalInterpolant(const GWFrames::Waveform& iW, const unsigned int Order)
+  : W(iW), NPoints(0), Uniform(false), t0(0.0), dt(0.0), InverseDenominators()
+{
+  /// \param iW Waveform to interpolate, which must outlive this object
+  /// \param Order Degree of the interpolating polynomials [Default: 5]
+  ///
+  /// If the Waveform has fewer than `Order+1` time steps, the order
+  /// is reduced to use all of them.  The times are considered
+  /// uniform if each differs from \f$t_0 + i\, \delta t\f$ by no more
+  /// than \f$10^{-8}\, \delta t\f$.
+  const vector<double>& t = W.t;
+  const unsigned int n = t.size();
+  if(n<2) {
+    INFOTOCERR << "\nError: Cannot construct an interpolant from " << n << " time steps." << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+  NPoints = std::min(Order+1, n);
+  if(NPoints<2) { NPoints = 2; }
+  t0 = t[0];
+  dt = (t.back()-t[0])/(n-1);
+  Uniform = (dt>0.0);
+  for(unsigned int i=1; i<n && Uniform; ++i) {
+    if(std::abs(t[i]-(t0+i*dt)) > 1e-8*dt) { Uniform = false; }
+  }
+  if(Uniform) {
+    // On nodes u=0,1,...,NPoints-1, the Lagrange basis polynomial for
+    // node k has denominator (-1)^{NPoints-1-k} k! (NPoints-1-k)!
+    InverseDenominators.resize(NPoints);
+    vector<double> Factorial(NPoints, 1.0);
+    for(unsigned int k=1; k<NPoints; ++k) { Factorial[k] = k*Factorial[k-1]; }
+    for(unsigned int k=0; k<NPoints; ++k) {
+      InverseDenominators[k] = ((NPoints-1-k)%2==0 ? 1.0 : -1.0) / (Factorial[k]*Factorial[NPoints-1-k]);
+    }
+  }
+}
+
+/// Find the stencil indices and weights needed to interpolate to the given times
+GWFrames::WaveformLocalInterpolant::Stencil GWFrames::WaveformLocalInterpolant::StencilAt(const std::vector<double>& NewTime) const {
+  return StencilAt((NewTime.size()>0 ? &NewTime[0] : 0), NewTime.size());
+}
+
+/// Find the stencil indices and weights needed to interpolate to the given times
+GWFrames::WaveformLocalInterpolant::Stencil GWFrames::WaveformLocalInterpolant::StencilAt(const double* NewTime, const unsigned int N) const {
+  /// \param NewTime Pointer to the times at which to evaluate
+  /// \param N Number of times
+  ///
+  /// For each new time \f$x\f$ in the interval \f$[t_j, t_{j+1}]\f$,
+  /// the stencil is the `Order+1` consecutive data points centered
+  /// as nearly as possible on that interval, and the weights are the
+  /// values of the Lagrange basis polynomials at \f$x\f$.  For
+  /// uniform times, the interval is found directly, and the weights
+  /// are products of \f$(u-k)\f$ with precomputed denominators.
+  /// Otherwise, the search for each interval begins where the last
+  /// one ended, as in `WaveformSpline::StencilAt`.  Times outside the
+  /// domain of the data are extrapolated from the nearest stencil;
+  /// it is up to the caller to check for those.
+  const vector<double>& t = W.t;
+  const unsigned int n = t.size();
+  const unsigned int m = NPoints;
+  const unsigned int Offset = (m-1)/2;
+  Stencil S;
+  S.Index.resize(N);
+  S.Weights.resize(N*m);
+  vector<double> Left(m+1), Right(m+1);
+  unsigned int j=0;
+  for(unsigned int i=0; i<N; ++i) {
+    const double x = NewTime[i];
+    double* w = &S.Weights[i*m];
+    if(Uniform) {
+      const double u = (x-t0)/dt;
+      j = (u<=0.0 ? 0 : std::min((unsigned int)(u), n-2));
+      const unsigned int k0 = (j<Offset ? 0 : std::min(j-Offset, n-m));
+      S.Index[i] = k0;
+      // w_k = (1/D_k) * prod_{l!=k} (v-l), with v measured from node k0
+      const double v = u-k0;
+      Left[0] = 1.0;
+      for(unsigned int k=0; k<m; ++k) { Left[k+1] = Left[k]*(v-k); }
+      Right[m] = 1.0;
+      for(unsigned int k=m; k>0; --k) { Right[k-1] = Right[k]*(v-(k-1)); }
+      for(unsigned int k=0; k<m; ++k) {
+        w[k] = Left[k]*Right[k+1]*InverseDenominators[k];
+      }
+    } else {
+      if(x<t[j]) {
+        j = std::upper_bound(t.begin(), t.end(), x) - t.begin();
+        j = (j>0 ? j-1 : 0);
+      }
+      while(j+2<n && t[j+1]<x) { ++j; }
+      const unsigned int k0 = (j<Offset ? 0 : std::min(j-Offset, n-m));
+      S.Index[i] = k0;
+      const double* tk = &t[k0];
+      for(unsigned int k=0; k<m; ++k) {
+        double Numerator=1.0, Denominator=1.0;
+        for(unsigned int l=0; l<m; ++l) {
+          if(l==k) { continue; }
+          Numerator *= x-tk[l];
+          Denominator *= tk[k]-tk[l];
+        }
+        w[k] = Numerator/Denominator;
+      }
+    }
+  }
+  return S;
+}
+
+/// Evaluate one mode of the interpolant using precomputed weights
+void GWFrames::WaveformLocalInterpolant::EvaluateMode(const unsigned int Mode, const Stencil& S, std::complex<double>* Out) const {
+  /// \param Mode Index of the mode to evaluate
+  /// \param S Stencil returned by `StencilAt`
+  /// \param Out Pointer to storage for `S.size()` values
+  ///
+  /// This does not allocate, and may be called for different modes
+  /// from different threads.
+  const complex<double>* y = W.data[Mode];
+  const unsigned int N = S.size();
+  const unsigned int m = NPoints;
+  const unsigned int* Index = S.Index.empty() ? 0 : &S.Index[0];
+  const double* Weights = S.Weights.empty() ? 0 : &S.Weights[0];
+  for(unsigned int i=0; i<N; ++i) {
+    const complex<double>* yi = y + Index[i];
+    const double* w = Weights + i*m;
+    complex<double> Sum(0.0, 0.0);
+    for(unsigned int k=0; k<m; ++k) {
+      Sum += w[k]*yi[k];
+    }
+    Out[i] = Sum;
+  }
+}
+
+/// Interpolate the Waveform to a new set of time instants
+GWFrames::Waveform GWFrames::WaveformLocalInterpolant::Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain) const {
+  /// \param NewTime New vector of times to which this interpolates
+  /// \param AllowTimesOutsideCurrentDomain [Default: false]
+  ///
+  /// The treatment of times outside the current domain, the frame,
+  /// and all metadata are just as in `Waveform::Interpolate`; only
+  /// the interpolation of the modes differs.
+  ///
+  std::stringstream Call;
+  Call << "InterpolateLocal(NewTime," << Order() << "," << AllowTimesOutsideCurrentDomain << ")";
+  unsigned int i0, i1;
+  Waveform C = W.InterpolationTarget(NewTime, AllowTimesOutsideCurrentDomain, Call.str(), i0, i1);
+  const unsigned int NModes = C.NModes();
+  const unsigned int i2 = NewTime.size();
+  const Stencil S = StencilAt(&NewTime[0]+i0, i1-i0);
+  #pragma omp parallel for if(NModes>1 && NewTime.size()>ParallelTimeThreshold)
+  for(int i_m=0; i_m<int(NModes); ++i_m) {
+    std::fill(C.data[i_m], C.data[i_m]+i0, complex<double>(0., 0.));
+    EvaluateMode(i_m, S, C.data[i_m]+i0);
+    std::fill(C.data[i_m]+i1, C.data[i_m]+i2, complex<double>(0., 0.));
+  }
+
+  return C;
+}
+
+
+/// Construct the Squad interpolant from rotors and the times at which they are given
+GWFrames::RotorTimeSeries::RotorTimeSeries(const std::vector<Quaternions::Quaternion>& iR, const std::vector<double>& T)
+  : t(T), R(iR), A(), B(), LogR(), LogAB()
+{
+  /// \param iR Rotors at each time step (or a single constant rotor)
+  /// \param T Times at which the rotors are given
+  ///
+  /// The control points are exactly those used by
+  /// `Quaternions::Squad`, including the extrapolated rotors used at
+  /// the first and last intervals.  An empty input is treated as the
+  /// identity, and a single rotor is treated as a constant.
+  if(R.size()==0) {
+    R.push_back(Quaternions::Quaternion(1,0,0,0));
+  }
+  if(R.size()==1) {
+    return;
+  }
+  if(R.size()!=t.size()) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": R.size()=" << R.size() << " != T.size()=" << t.size() << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  const unsigned int n = t.size();
+  A.resize(n-1);
+  B.resize(n-1);
+  LogR.resize(n-1);
+  LogAB.resize(n-1);
+  #pragma omp parallel for if(n>ParallelTimeThreshold)
+  for(int i=0; i<int(n)-1; ++i) {
+    double Dtim1, Dti, Dtip1;
+    Quaternion Qim1, Qi, Qip1, Qip2;
+    Dti = t[i+1]-t[i];
+    Qi = R[i];
+    Qip1 = R[i+1];
+    if(i==0) {
+      Dtim1 = Dti;
+      Qim1 = R[1]*R[0].inverse()*R[1];
+    } else {
+      Dtim1 = t[i]-t[i-1];
+      Qim1 = R[i-1];
+    }
+    if(i+2==int(n)) {
+      Dtip1 = Dti;
+      Qip2 = R[i+1]*R[i].inverse()*R[i+1];
+    } else {
+      Dtip1 = t[i+2]-t[i+1];
+      Qip2 = R[i+2];
+    }
+    const Quaternion LogQiQip1 = (Qi.inverse()*Qip1).log();
+    A[i] = Qi*((LogQiQip1 + (Dti/Dtim1)*(Qim1.inverse()*Qi).log() - 2*LogQiQip1)*0.25).exp();
+    B[i] = Qip1*(((Dti/Dtip1)*(Qip1.inverse()*Qip2).log() + LogQiQip1 - 2*LogQiQip1)*-0.25).exp();
+    // Each Slerp(tau, Qa, Qb) is exp(tau*log(Qb/Qa))*Qa, so the logs
+    // can be found here once
+    LogR[i] = (Qip1*Qi.inverse()).log();
+    LogAB[i] = (B[i]*A[i].inverse()).log();
+  }
+}
+
+/// Construct the Squad interpolant of a Waveform's frame
+GWFrames::RotorTimeSeries::RotorTimeSeries(const GWFrames::Waveform& W)
+  : RotorTimeSeries(W.Frame(), W.T())
+{ }
+
+/// Find the interval containing the given time, beginning the search at interval j
+unsigned int GWFrames::RotorTimeSeries::Interval(const double t_i, unsigned int j) const {
+  /// Times outside the domain of the data are assigned to the first
+  /// or last interval.
+  const unsigned int n = t.size();
+  if(t_i<t[j]) {
+    j = std::upper_bound(t.begin(), t.end(), t_i) - t.begin();
+    j = (j>0 ? j-1 : 0);
+  }
+  while(j+2<n && t[j+1]<t_i) { ++j; }
+  return j;
+}
+
+/// Evaluate the interpolant at the given time, which lies in interval j
+Quaternions::Quaternion GWFrames::RotorTimeSeries::Evaluate(const double t_i, const unsigned int j) const {
+  const double tau = (t_i-t[j])/(t[j+1]-t[j]);
+  return Quaternions::Slerp(2*tau*(1-tau), (tau*LogR[j]).exp()*R[j], (tau*LogAB[j]).exp()*A[j]);
+}
+
+/// Evaluate the interpolant at a single time
+Quaternions::Quaternion GWFrames::RotorTimeSeries::Evaluate(const double t_i) const {
+  if(R.size()==1) { return R[0]; }
+  return Evaluate(t_i, Interval(t_i, 0));
+}
+
+/// Evaluate the interpolant at a set of (shifted) times
+std::vector<Quaternions::Quaternion> GWFrames::RotorTimeSeries::Evaluate(const std::vector<double>& NewTime, const double Offset) const {
+  /// \param NewTime Times at which to evaluate
+  /// \param Offset Constant added to each element of `NewTime` [default: 0.0]
+  ///
+  /// The rotors are evaluated at `NewTime[i]+Offset`, which avoids
+  /// constructing the shifted time series.  The search for each
+  /// interval begins where the last one ended, so this is linear in
+  /// the number of times when `NewTime` is sorted.  Unlike
+  /// `Quaternions::Squad`, times outside the domain of the data are
+  /// extrapolated from the first or last interval; it is up to the
+  /// caller to check for those.
+  const unsigned int N = NewTime.size();
+  if(R.size()==1) { return std::vector<Quaternion>(N, R[0]); }
+  std::vector<unsigned int> Index(N);
+  unsigned int j=0;
+  for(unsigned int i=0; i<N; ++i) {
+    j = Interval(NewTime[i]+Offset, j);
+    Index[i] = j;
+  }
+  std::vector<Quaternion> ROut(N);
+  #pragma omp parallel for if(N>ParallelTimeThreshold)
+  for(int i=0; i<int(N); ++i) {
+    ROut[i] = Evaluate(NewTime[i]+Offset, Index[i]);
+  }
+  return ROut;
+}
+
+/// Evaluate the interpolant of `R_left * R * R_right` at a set of (shifted) times
+std::vector<Quaternions::Quaternion> GWFrames::RotorTimeSeries::Evaluate(const std::vector<double>& NewTime, const double Offset,
+                                                                         const Quaternions::Quaternion& R_left,
+                                                                         const Quaternions::Quaternion& R_right) const {
+  /// \param NewTime Times at which to evaluate
+  /// \param Offset Constant added to each element of `NewTime`
+  /// \param R_left Constant rotor multiplying the data on the left
+  /// \param R_right Constant rotor multiplying the data on the right
+  ///
+  /// This gives the same result as
+  /// `Quaternions::Squad(R_left*R*R_right, T, NewTime+Offset)`, but
+  /// reuses the control points found on construction.
+  std::vector<Quaternion> ROut = Evaluate(NewTime, Offset);
+  for(unsigned int i=0; i<ROut.size(); ++i) {
+    ROut[i] = R_left * ROut[i] * R_right;
+  }
+  return ROut;
+}
+
+
+/// Find the appropriate rotations to fix the attitude of the corotating frame.
+std::vector<Quaternions::Quaternion> GWFrames::Waveform::GetAlignmentsOfDecompositionFrameToModes(const std::vector<int>& Lmodes) const {
+  ///
+  /// \param Lmodes Lmodes to use in computing \f$<LL>\f$
+  ///
+  /// This function finds the appropriate pre-multiplied rotation
+  /// \f$R_{\varepsilon}\f$ so that the decomposition frame is aligned
+  /// to the waveform.  This particular version finds the appropriate
+  /// \f$R_{\varepsilon}\f$ at each time in the input Waveform.  This
+  /// is useful in cases where we need to try many such alignments,
+  /// because the setup for interpolation is very slow.
+  ///
+  /// Note that this function has no option to choose the direction of
+  /// X based on some nHat vector, as other similar functions have.
+  /// That issue is assumed to be handled elsewhere.
+
+  if(frameType!=GWFrames::Coprecessing && frameType!=GWFrames::Coorbital && frameType!=GWFrames::Corotating) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
+              << "\nError: GetAlignmentsOfDecompositionFrameToModes only takes Waveforms in the "
+              << GWFrames::WaveformFrameNames[GWFrames::Coprecessing] << ", "
+              << GWFrames::WaveformFrameNames[GWFrames::Coorbital] << ", or "
+              << GWFrames::WaveformFrameNames[GWFrames::Corotating] << " frames."
+              << "\n       This Waveform is in the " << GWFrames::WaveformFrameNames[frameType] << " frame." << std::endl;
+    throw(GWFrames_WrongFrameType);
+  }
+
+  if(frame.size()!=NTimes()) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":"
+              << "\nError: GetAlignmentsOfDecompositionFrameToModes requires full information about the Waveform's frame."
+              << "\n       This Waveform has " << NTimes() << " time steps, but " << frame.size() << " rotors in its frame data." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  // This will be the returned quantity
+  std::vector<Quaternion> R_eps(NTimes());
+
+  // Get direction of angular-velocity vector at each time step, in this frame
+  const vector<Quaternion> omegaHat
+    = Quaternions::inverse(frame)
+    * Quaternions::normalized(Quaternions::QuaternionArray(this->AngularVelocityVectorRelativeToInertial())) * frame;
 
-    // R_V_hi is the rotor taking the Z axis onto V_hi
-    const Quaternion R_V_hi = Quaternions::sqrtOfRotor(-V_hi*Quaternions::zHat);
+  const vector<vector<double> > V_h = this->LLDominantEigenvector(Lmodes);
+
+  // Indices of the ell=2 modes, which are all we need to find the
+  // phases of the rotated (2,+/-2) modes
+  unsigned int i_2[5];
+  for(int m=-2; m<=2; ++m) {
+    i_2[m+2] = FindModeIndex(2,m);
+  }
 
-    // Now rotate Instant so that its z axis is aligned with V_f
-    Waveform Instant = this->SliceOfTimeIndices(i_t);
-    Instant.RotateDecompositionBasis(R_V_hi);
+  // Rather than slicing out a Waveform at each instant and rotating
+  // all of its modes, we just evaluate the two rotated modes we need
+  // directly from the data:
+  //   h'^{2,m} = \sum_{m'} D^{(2)}_{m',m}(R_V_hi) h^{2,m'}
+  const int NTimes = this->NTimes();
+  #pragma omp parallel if(NTimes>ParallelTimeThreshold)
+  {
+    SphericalFunctions::WignerDMatrix D(Quaternions::Quaternion(1,0,0,0));
+
+    #pragma omp for schedule(static)
+    for(int i_t=0; i_t<NTimes; ++i_t) {
+      // Choose the normalized eigenvector more parallel to omegaHat than anti-parallel
+      const Quaternion V_hi = (omegaHat[i_t].dot(V_h[i_t]) < 0 ? -Quaternions::normalized(V_h[i_t]) : Quaternions::normalized(V_h[i_t]));
+
+      // R_V_hi is the rotor taking the Z axis onto V_hi
+      const Quaternion R_V_hi = Quaternions::sqrtOfRotor(-V_hi*Quaternions::zHat);
+
+      // Find the (2,+/-2) modes as measured in the frame whose z axis
+      // is aligned with V_hi
+      D.SetRotation(R_V_hi);
+      complex<double> h_22(0.0, 0.0), h_2m2(0.0, 0.0);
+      for(int mp=-2; mp<=2; ++mp) {
+        const complex<double> h_2mp = data[i_2[mp+2]][i_t];
+        h_22 += D(2,mp,2) * h_2mp;
+        h_2m2 += D(2,mp,-2) * h_2mp;
+      }
 
-    // Get the phase of the (2,+/-2) modes after rotation
-    const double phase_22 = std::atan2(Instant.Im(i_22,0),Instant.Re(i_22,0));
-    const double phase_2m2 = std::atan2(Instant.Im(i_2m2,0),Instant.Re(i_2m2,0));
+      // Get the phase of the (2,+/-2) modes after rotation
+      const double phase_22 = std::atan2(h_22.imag(), h_22.real());
+      const double phase_2m2 = std::atan2(h_2m2.imag(), h_2m2.real());
 
-    // R_eps is the rotation we will be applying on the right-hand side
-    R_eps[i_t] = R_V_hi * Quaternions::exp(Quaternions::Quaternion(0,0,0,(-(phase_22+phase_2m2)/8.)));
+      // R_eps is the rotation we will be applying on the right-hand side
+      R_eps[i_t] = R_V_hi * Quaternions::exp(Quaternions::Quaternion(0,0,0,(-(phase_22+phase_2m2)/8.)));
+    }
   }
 
   return UnflipRotors(R_eps);
@@ -2291,17 +3272,19 @@ public:
   std::vector<double> t_A;
   const GWFrames::Waveform& W_A;
   const GWFrames::Waveform& W_B;
+  const GWFrames::RotorTimeSeries R_fB; // Squad control points for W_B's frame, found just once
   const double t_mid;
   std::vector<Quaternion> R_epsB;
   bool R_epsB_is_set;
-  mutable unsigned int Rbar_epsB_i; // Just a guess to speed up hunting for the index
+  const double GradientTimeStep; // Step in deltat for the finite-difference part of the gradient
   const bool Debug;
   mutable ofstream UpsilonFile;
 public:
   WaveformAligner(const GWFrames::Waveform& iW_A, const GWFrames::Waveform& iW_B,
                   const double t_1, const double t_2, const bool iDebug)
-    : R_fA(iW_A.Frame()), t_A(iW_A.T()), W_A(iW_A), W_B(iW_B), t_mid((t_1+t_2)/2.),
-      R_epsB(0), R_epsB_is_set(false), Rbar_epsB_i(0), Debug(iDebug),
+    : R_fA(iW_A.Frame()), t_A(iW_A.T()), W_A(iW_A), W_B(iW_B), R_fB(iW_B), t_mid((t_1+t_2)/2.),
+      R_epsB(0), R_epsB_is_set(false),
+      GradientTimeStep(1.0e-4*std::max(iW_A.T(1)-iW_A.T(0), iW_B.T(1)-iW_B.T(0))), Debug(iDebug),
       UpsilonFile()
   {
     // Check to make sure we have sufficient times before any offset.
@@ -2365,7 +3348,7 @@ public:
   }
 
   std::vector<Quaternion> Rbar_fB(const std::vector<double>& t) const {
-    return Quaternions::conjugate(Quaternions::Squad(W_B.Frame(), W_B.T(), t));
+    return Quaternions::conjugate(R_fB.Evaluate(t));
   }
 
   Quaternion Rbar_epsB(const double t) const {
@@ -2373,26 +3356,129 @@ public:
       std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": R_epsB has not yet been set." << std::endl;
       throw(GWFrames_ValueError);
     }
-    Rbar_epsB_i = Quaternions::hunt(W_B.T(), t, Rbar_epsB_i);
-    return Quaternions::conjugate(R_epsB[Rbar_epsB_i]);
+    // No index is cached between calls, so that this may be called from several threads at once
+    return Quaternions::conjugate(R_epsB[Quaternions::hunt(W_B.T(), t, 0)]);
+  }
+
+  void XiIntegralsByCorrelation(const std::vector<double>& deltats,
+                                std::vector<Quaternion>& XiIntegral1, std::vector<Quaternion>& XiIntegral2) const {
+    // The integrand of XiIntegral1 at each deltat is
+    //   R_fA(t) * Rbar_epsB(t_mid+deltat) * Rbar_fB(t+deltat),
+    // where the middle factor is constant in t.  Expanding that
+    // constant C in the basis E_c = {1, x, y, z}, this is bilinear in
+    // the components of R_fA and Rbar_fB, so
+    //   XiIntegral1(deltat) = sum_{a,b} X_{ab}(deltat) E_a * C * E_b,
+    // where the X_{ab} are the 16 cross-correlations
+    //   X_{ab}(deltat) = \int R_fA^a(t) Rbar_fB^b(t+deltat) dt.
+    // Those are found for all deltat at once by FFT on a uniform grid
+    // with the mean spacing of t_A, then interpolated to `deltats`.
+    // The same correlations give XiIntegral2, with C replaced by
+    // -zHat*Rbar_epsB.
+    using WaveformUtilities::dft;
+    using WaveformUtilities::idft;
+    const unsigned int NDeltats = deltats.size();
+    XiIntegral1.resize(NDeltats);
+    XiIntegral2.resize(NDeltats);
+    if(NDeltats==0) { return; }
+    const double deltat_min = *std::min_element(deltats.begin(), deltats.end());
+    const double deltat_max = *std::max_element(deltats.begin(), deltats.end());
+    const unsigned int M = t_A.size();
+    if(M<2) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": The alignment window holds " << M << " time steps of W_A;"
+                << "\n    FFTScan needs at least two." << std::endl;
+      throw(GWFrames_ValueError);
+    }
+    const double h = (t_A.back()-t_A[0])/(M-1);
+    const unsigned int K = std::max(4, int(std::ceil((deltat_max-deltat_min)/h))+1);
+    const unsigned int L = WaveformUtilities::NextFastFFTSize(M+K);
+
+    // Evaluate both frames on uniform grids; R_fA on the window, and
+    // Rbar_fB on the window extended by the range of deltat
+    std::vector<double> tau(M), s(M+K-1);
+    for(unsigned int n=0; n<M; ++n) { tau[n] = t_A[0]+n*h; }
+    tau[M-1] = t_A.back();
+    for(unsigned int m=0; m<M+K-1; ++m) { s[m] = t_A[0]+deltat_min+m*h; }
+    const std::vector<Quaternion> A = GWFrames::RotorTimeSeries(R_fA, t_A).Evaluate(tau);
+    const std::vector<Quaternion> B = Rbar_fB(s);
+
+    // Transform each component, with trapezoidal weights on A; these
+    // vectors hold complex data as interleaved real and imaginary parts
+    std::vector<std::vector<double> > FA(4, std::vector<double>(2*L, 0.0)), FB(4, std::vector<double>(2*L, 0.0));
+    #pragma omp parallel for if(L>ParallelTimeThreshold)
+    for(int c=0; c<8; ++c) {
+      if(c<4) {
+        for(unsigned int n=0; n<M; ++n) {
+          FA[c][2*n] = (n==0 || n==M-1 ? h/2.0 : h) * A[n][c];
+        }
+        dft(FA[c]);
+      } else {
+        for(unsigned int m=0; m<M+K-1; ++m) {
+          FB[c-4][2*m] = B[m][c-4];
+        }
+        dft(FB[c-4]);
+      }
+    }
+
+    // X_{ab}[k] = sum_n A_a[n] B_b[n+k] is the inverse transform of
+    // conj(FA_a)*FB_b.  These are real, so two of them are found with
+    // each inverse transform, as its real and imaginary parts.
+    std::vector<std::vector<double> > X(16, std::vector<double>(K));
+    #pragma omp parallel for if(L>ParallelTimeThreshold)
+    for(int ab=0; ab<16; ab+=2) {
+      const unsigned int a = ab/4, b = ab%4;
+      std::vector<double> Z(2*L);
+      for(unsigned int f=0; f<L; ++f) {
+        const std::complex<double> FAbar(FA[a][2*f], -FA[a][2*f+1]);
+        const std::complex<double> Z_f = FAbar*std::complex<double>(FB[b][2*f], FB[b][2*f+1])
+          + std::complex<double>(0.0, 1.0)*FAbar*std::complex<double>(FB[b+1][2*f], FB[b+1][2*f+1]);
+        Z[2*f] = Z_f.real();
+        Z[2*f+1] = Z_f.imag();
+      }
+      idft(Z);
+      for(unsigned int k=0; k<K; ++k) {
+        X[ab][k] = Z[2*k]/L;
+        X[ab+1][k] = Z[2*k+1]/L;
+      }
+    }
+
+    // Interpolate (cubic Lagrange) to each deltat, and assemble the integrals
+    const Quaternion E[4] = { Quaternion(1,0,0,0), Quaternion(0,1,0,0), Quaternion(0,0,1,0), Quaternion(0,0,0,1) };
+    for(unsigned int i=0; i<NDeltats; ++i) {
+      const double x = (deltats[i]-deltat_min)/h;
+      const int k = std::min(std::max(int(std::floor(x))-1, 0), int(K)-4);
+      const double u = x-k;
+      const double w[4] = { -(u-1)*(u-2)*(u-3)/6.0, u*(u-2)*(u-3)/2.0, -u*(u-1)*(u-3)/2.0, u*(u-1)*(u-2)/6.0 };
+      const Quaternion C1 = Rbar_epsB(t_mid+deltats[i]);
+      const Quaternion C2 = (-Quaternions::zHat)*C1;
+      XiIntegral1[i] = Quaternion(0,0,0,0);
+      XiIntegral2[i] = Quaternion(0,0,0,0);
+      for(unsigned int ab=0; ab<16; ++ab) {
+        const double X_ab = w[0]*X[ab][k] + w[1]*X[ab][k+1] + w[2]*X[ab][k+2] + w[3]*X[ab][k+3];
+        XiIntegral1[i] = XiIntegral1[i] + X_ab*(E[ab/4]*C1*E[ab%4]);
+        XiIntegral2[i] = XiIntegral2[i] + X_ab*(E[ab/4]*C2*E[ab%4]);
+      }
+    }
+    return;
   }
 
   void FindBestMinimizationWaveform(const std::vector<std::vector<double> >& optima, const std::vector<bool>& try_version,
                                     double& deltat, Quaternion& R_delta, Quaternion& R_eps) const {
     using namespace Quaternions; // Allow me to add a double to a vector<double> below
     const GWFrames::Waveform W_A_interp = W_A.Interpolate(t_A);
+    // W_B is interpolated to the same times for every branch, so do
+    // that just once and copy the result
+    const GWFrames::Waveform W_B_t_A = GWFrames::WaveformSpline(W_B).Interpolate(t_A);
+    const unsigned int ntimes = W_B_t_A.NTimes();
+    const unsigned int nmodes = W_B_t_A.NModes();
     vector<double> Norms(4, 1e300);
     const Quaternions::Quaternion R_eps0 = W_B.GetAlignmentOfDecompositionFrameToModes(t_mid, Quaternions::xHat);
     for(unsigned int branch_choice=0; branch_choice<4; ++branch_choice) {
-      GWFrames::Waveform W_B_interp = W_B.Interpolate(t_A+optima[branch_choice][0]);
-      const unsigned int ntimes = W_B_interp.NTimes();
-      const unsigned int nmodes = W_B_interp.NModes();
       if(try_version[branch_choice]) {
         if(branch_choice==0) { R_eps = R_eps0; }
         else if(branch_choice==1) { R_eps = -R_eps0; }
         else if(branch_choice==2) { R_eps = R_eps0*Quaternions::zHat; }
         else if(branch_choice==3) { R_eps = -R_eps0*Quaternions::zHat; }
-        W_B_interp = W_B.Interpolate(t_A);
+        GWFrames::Waveform W_B_interp(W_B_t_A);
         W_B_interp.RotateDecompositionBasis(R_eps);
         for(unsigned int i_B=0; i_B<nmodes; ++i_B) {
           const unsigned int i_A = W_A_interp.FindModeIndex(W_B.LM(i_B)[0], W_B.LM(i_B)[1]);
@@ -2427,14 +3513,21 @@ public:
       INFOTOCERR << "Somehow, I found a min norm that wasn't equal to itself..." << std::endl;
       throw(GWFrames_ValueError);
     }
+    // The norms above compare W_B at t_A, so check separately that the
+    // chosen time offset keeps t_A+deltat inside the domain of W_B
+    if(t_A[0]+deltat<W_B.T(0) || t_A.back()+deltat>W_B.T(W_B.NTimes()-1)) {
+      INFOTOCERR << "\nError: The optimal deltat=" << deltat << " shifts t_A=[" << t_A[0] << "," << t_A.back() << "]"
+                 << " outside the domain of W_B=[" << W_B.T(0) << "," << W_B.T(W_B.NTimes()-1) << "]." << std::endl;
+      throw(GWFrames_EmptyIntersection);
+    }
     return;
   }
 
   double EvaluateMinimizationQuantity(const double deltat, const double deltax, const double deltay, const double deltaz) const {
-    using namespace Quaternions; // Allow me to add a double to a vector<double> below
     const Quaternions::Quaternion R_eps = W_B.GetAlignmentOfDecompositionFrameToModes(t_mid+deltat, Quaternions::xHat);
     const Quaternions::Quaternion R_delta = Quaternions::exp(Quaternions::Quaternion(0, deltax, deltay, deltaz));
-    const std::vector<Quaternions::Quaternion> R_Bprime = Quaternions::Squad(R_delta * W_B.Frame() * R_eps, W_B.T(), t_A+deltat);
+    // Squad(R_delta * W_B.Frame() * R_eps, W_B.T(), t_A+deltat), without recomputing the control points
+    const std::vector<Quaternions::Quaternion> R_Bprime = R_fB.Evaluate(t_A, deltat, R_delta, R_eps);
     const unsigned int Size=R_Bprime.size();
     double f = 0.0;
     double fdot_last = 4 * Quaternions::normsquared( Quaternions::logRotor( R_fA[0] * Quaternions::inverse(R_Bprime[0]) ) );
@@ -2444,8 +3537,70 @@ public:
       fdot_last = fdot;
     }
     if(Debug) {
-      UpsilonFile << std::setprecision(15);
-      UpsilonFile << deltat << " " << deltax << " " << deltay << " " << deltaz << " " << f << std::endl;
+      #pragma omp critical(UpsilonFile)
+      {
+        UpsilonFile << std::setprecision(15);
+        UpsilonFile << deltat << " " << deltax << " " << deltay << " " << deltaz << " " << f << std::endl;
+      }
+    }
+    return f;
+  }
+
+  double EvaluateMinimizationQuantityAndGradient(const double deltat, const double deltax, const double deltay, const double deltaz,
+                                                 double* Gradient) const {
+    // With P = R_fA * (R_fB * R_eps)^{-1} and r = (deltax, deltay,
+    // deltaz), the integrand is 4*theta^2, where cos(theta) is the
+    // scalar part of P*exp(-r), which is
+    //   w = P_w*cos|r| + (sin|r|/|r|)*(P_v . r).
+    // So the derivatives with respect to r follow directly from
+    // dtheta/dw = -1/sin(theta), and are integrated exactly as the
+    // objective is.  R_eps depends on deltat through the dominant
+    // eigenvector of <LL> near t_mid+deltat, so the derivative with
+    // respect to deltat is taken by centered differences.
+    const Quaternions::Quaternion R_eps = W_B.GetAlignmentOfDecompositionFrameToModes(t_mid+deltat, Quaternions::xHat);
+    const Quaternions::Quaternion R_delta = Quaternions::exp(Quaternions::Quaternion(0, deltax, deltay, deltaz));
+    const Quaternions::Quaternion Rbar_eps = Quaternions::inverse(R_eps);
+    const std::vector<Quaternions::Quaternion> R_fB_t = R_fB.Evaluate(t_A, deltat);
+    const double r[3] = {deltax, deltay, deltaz};
+    const double rho = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
+    const double cosrho = std::cos(rho);
+    // sinc = sin(rho)/rho, and dsinc = (d sinc/d rho)/rho
+    const double sinc = (rho<1.0e-4 ? 1.0-rho*rho/6.0 : std::sin(rho)/rho);
+    const double dsinc = (rho<1.0e-4 ? -1.0/3.0+rho*rho/30.0 : (cosrho-sinc)/(rho*rho));
+    const unsigned int Size=R_fB_t.size();
+    double f = 0.0;
+    double df[3] = {0.0, 0.0, 0.0};
+    double fdot_last = 0.0;
+    double dfdot_last[3] = {0.0, 0.0, 0.0};
+    for(unsigned int i=0; i<Size; ++i) {
+      // This is exactly the integrand of EvaluateMinimizationQuantity
+      const double fdot = 4 * Quaternions::normsquared( Quaternions::logRotor( R_fA[i] * Quaternions::inverse(R_delta * R_fB_t[i] * R_eps) ) );
+      const Quaternions::Quaternion P = R_fA[i] * Rbar_eps * Quaternions::inverse(R_fB_t[i]);
+      const double Pdotr = P[1]*r[0] + P[2]*r[1] + P[3]*r[2];
+      const double w = P[0]*cosrho + sinc*Pdotr;
+      const double sintheta = std::sqrt(std::max(1.0-w*w, 0.0));
+      const double theta = std::atan2(sintheta, w);
+      const double dfdotdw = -8 * (sintheta>1.0e-12 ? theta/sintheta : 1.0);
+      double dfdot[3];
+      for(unsigned int j=0; j<3; ++j) {
+        dfdot[j] = dfdotdw * (sinc*(P[j+1]-P[0]*r[j]) + dsinc*Pdotr*r[j]);
+      }
+      if(i>0) {
+        const double dt = t_A[i]-t_A[i-1];
+        f += dt*(fdot+fdot_last)/2.0;
+        for(unsigned int j=0; j<3; ++j) {
+          df[j] += dt*(dfdot[j]+dfdot_last[j])/2.0;
+        }
+      }
+      fdot_last = fdot;
+      for(unsigned int j=0; j<3; ++j) {
+        dfdot_last[j] = dfdot[j];
+      }
+    }
+    Gradient[0] = (EvaluateMinimizationQuantity(deltat+GradientTimeStep, deltax, deltay, deltaz)
+                   - EvaluateMinimizationQuantity(deltat-GradientTimeStep, deltax, deltay, deltaz)) / (2*GradientTimeStep);
+    for(unsigned int j=0; j<3; ++j) {
+      Gradient[j+1] = df[j];
     }
     return f;
   }
@@ -2457,11 +3612,143 @@ double minfunc (const gsl_vector* delta, void* params) {
                                                gsl_vector_get(delta,2),
                                                gsl_vector_get(delta,3));
 }
+// The gradient optimizer takes a single initial step size for all
+// coordinates, so its first coordinate is deltat/TimeScale, where
+// TimeScale is chosen to make that step comparable in time and angle
+struct ScaledWaveformAligner {
+  WaveformAligner* Aligner;
+  double TimeScale;
+};
+double minfunc_scaled (const gsl_vector* delta, void* params) {
+  ScaledWaveformAligner* Scaled = (ScaledWaveformAligner*) params;
+  return Scaled->Aligner->EvaluateMinimizationQuantity(Scaled->TimeScale*gsl_vector_get(delta,0),
+                                                       gsl_vector_get(delta,1),
+                                                       gsl_vector_get(delta,2),
+                                                       gsl_vector_get(delta,3));
+}
+void minfunc_fdf (const gsl_vector* delta, void* params, double* f, gsl_vector* df) {
+  ScaledWaveformAligner* Scaled = (ScaledWaveformAligner*) params;
+  double Gradient[4];
+  *f = Scaled->Aligner->EvaluateMinimizationQuantityAndGradient(Scaled->TimeScale*gsl_vector_get(delta,0),
+                                                                gsl_vector_get(delta,1),
+                                                                gsl_vector_get(delta,2),
+                                                                gsl_vector_get(delta,3),
+                                                                Gradient);
+  Gradient[0] *= Scaled->TimeScale;
+  for(unsigned int j=0; j<4; ++j) {
+    gsl_vector_set(df, j, Gradient[j]);
+  }
+}
+void minfunc_df (const gsl_vector* delta, void* params, gsl_vector* df) {
+  double f;
+  minfunc_fdf(delta, params, &f, df);
+}
+double WallTime() {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return now.tv_sec + now.tv_usec/1000000.0;
+}
+// Minimize the objective function for one branch, starting from (and
+// returning the optimum in) `optimum`.  This allocates everything it
+// uses, so several branches may be minimized at once.
+unsigned int MinimizeUpsilon(WaveformAligner& Aligner, const bool GradientOptimizer,
+                             const double InitialTrialTimeStep, const double InitialTrialAngleStep, const double MinGradient,
+                             std::vector<double>& optimum, double& Upsilon, int& status) {
+  const unsigned int NDimensions = 4;
+  const unsigned int MaxIterations = 2000;
+  const double MinSimplexSize = 2.0e-9;
+  size_t iter = 0;
+  status = GSL_CONTINUE;
+
+  // Set initial values
+  gsl_vector* x = gsl_vector_alloc(NDimensions);
+  for(unsigned int j=0; j<NDimensions; ++j) {
+    gsl_vector_set(x, j, optimum[j]);
+  }
+
+  if(GradientOptimizer) {
+    // Use BFGS with the gradient of the objective function.  The
+    // first coordinate is rescaled so that the initial step is
+    // InitialTrialTimeStep in deltat, and InitialTrialAngleStep in
+    // each angle.
+    ScaledWaveformAligner Scaled;
+    Scaled.Aligner = &Aligner;
+    Scaled.TimeScale = InitialTrialTimeStep/InitialTrialAngleStep;
+    gsl_vector_set(x, 0, optimum[0]/Scaled.TimeScale);
+
+    gsl_multimin_function_fdf min_func;
+    min_func.n = NDimensions;
+    min_func.f = &minfunc_scaled;
+    min_func.df = &minfunc_df;
+    min_func.fdf = &minfunc_fdf;
+    min_func.params = (void*) &Scaled;
+
+    gsl_multimin_fdfminimizer* s = gsl_multimin_fdfminimizer_alloc(gsl_multimin_fdfminimizer_vector_bfgs2, NDimensions);
+    gsl_multimin_fdfminimizer_set(s, &min_func, x, InitialTrialAngleStep, 0.1);
+
+    // Run the minimization
+    while(status == GSL_CONTINUE && iter < MaxIterations) {
+      iter++;
+      status = gsl_multimin_fdfminimizer_iterate(s);
+      if(status) break;
+      status = gsl_multimin_test_gradient(s->gradient, MinGradient);
+    }
+
+    // Get time shift, rotation, and the value of the objective function there
+    for(unsigned int j=0; j<NDimensions; ++j) {
+      optimum[j] = gsl_vector_get(s->x, j);
+    }
+    optimum[0] *= Scaled.TimeScale;
+    Upsilon = s->f;
+
+    gsl_multimin_fdfminimizer_free(s);
+  } else {
+    // Use Nelder-Mead simplex minimization
+    gsl_multimin_function min_func;
+    min_func.n = NDimensions;
+    min_func.f = &minfunc;
+    min_func.params = (void*) &Aligner;
+
+    // Set initial step sizes
+    gsl_vector* ss = gsl_vector_alloc(NDimensions);
+    gsl_vector_set(ss, 0, InitialTrialTimeStep);
+    gsl_vector_set(ss, 1, InitialTrialAngleStep);
+    gsl_vector_set(ss, 2, InitialTrialAngleStep);
+    gsl_vector_set(ss, 3, InitialTrialAngleStep);
+
+    gsl_multimin_fminimizer* s = gsl_multimin_fminimizer_alloc(gsl_multimin_fminimizer_nmsimplex2, NDimensions);
+    gsl_multimin_fminimizer_set(s, &min_func, x, ss);
+
+    // Run the minimization
+    while(status == GSL_CONTINUE && iter < MaxIterations) {
+      iter++;
+      status = gsl_multimin_fminimizer_iterate(s);
+      if(status) break;
+      const double size = gsl_multimin_fminimizer_size(s);
+      status = gsl_multimin_test_size(size, MinSimplexSize);
+    }
+
+    // Get time shift, rotation, and the value of the objective function there
+    for(unsigned int j=0; j<NDimensions; ++j) {
+      optimum[j] = gsl_vector_get(s->x, j);
+    }
+    Upsilon = s->fval;
+
+    gsl_vector_free(ss);
+    gsl_multimin_fminimizer_free(s);
+  }
+
+  gsl_vector_free(x);
+  if(iter==MaxIterations && status==GSL_CONTINUE) { status = GSL_EMAXITER; }
+  return iter;
+}
 #endif // DOXYGEN
 
 /// Do everything necessary to align two waveform objects
-void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
-                              const double t_1, const double t_2, unsigned int InitialEvaluations, std::vector<double> nHat_A, const bool Debug)
+GWFrames::AlignWaveformsStatistics GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
+                                                            const double t_1, const double t_2, unsigned int InitialEvaluations,
+                                                            std::vector<double> nHat_A, const bool Debug, const bool GradientOptimizer,
+                                                            const bool FFTScan)
 {
   /// \param W_A Fixed waveform (though modes are re-aligned)
   /// \param W_B Adjusted waveform (modes are re-aligned and frame and time are offset)
@@ -2469,6 +3756,9 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
   /// \param t_2 End of alignment interval
   /// \param InitialEvaluations Number of evaluations for dumb initial optimization
   /// \param nHat_A Approximate nHat vector at (t_1+t_2)/2. [optional]
+  /// \param Debug Write the objective function to XiIntegral.dat and UpsilonIntegral.dat [default: false]
+  /// \param GradientOptimizer Use BFGS with the gradient of the objective function, rather than Nelder-Mead [default: false]
+  /// \param FFTScan Find the initial guess by cross-correlation, rather than integrating at each deltat [default: false]
   ///
   /// This function aligns the frame to the waveform modes for both
   /// input Waveform objects at time t_mid = (t_1+t_2)/2.  It also
@@ -2502,6 +3792,17 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
   /// (Mike Boyle) do hereby guarantee that this algorithm will find
   /// the optimal alignment in both time and attitude.  Or your money
   /// back.
+  ///
+  /// The scan over deltat and the minimizations for the (up to four)
+  /// branches are each run concurrently with OpenMP.  The returned
+  /// object records the time and iterations spent on each stage.
+  ///
+  /// The initial scan over deltat costs O(N_deltat * N_window) by
+  /// default.  With `FFTScan`, the frames are resampled to a uniform
+  /// grid and the integrals for all deltat are found by FFT
+  /// cross-correlation in O(N log N); the result is then refined by
+  /// the same minimization as usual, but the initial guess may differ
+  /// slightly from the default path.
 
   if(nHat_A.size()==0) {
     nHat_A = Quaternions::xHat.vec();
@@ -2571,8 +3872,19 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
   std::vector<bool> try_branch(4, false);
   std::vector<std::vector<double> > optima(4, std::vector<double>(4));
 
-  struct timeval now;
-  gettimeofday(&now, NULL); unsigned long long tNow = now.tv_usec + (unsigned long long)now.tv_sec * 1000000;
+  AlignWaveformsStatistics Statistics;
+  Statistics.ScanTime = 0.0;
+  Statistics.ScanEvaluations = 0;
+  Statistics.OptimizationTime = 0.0;
+  Statistics.BranchTimes = std::vector<double>(4, 0.0);
+  Statistics.BranchIterations = std::vector<unsigned int>(4, 0);
+  Statistics.BranchUpsilon = std::vector<double>(4, 1e300);
+  Statistics.Error = 0;
+  const double tStart = WallTime();
+
+  // Errors thrown inside the parallel regions below are caught there,
+  // and thrown again once the threads have finished
+  int Error = 0;
 
   // First, minimize the dumb way, by just evaluating at every deltat
   // in W_B so that we don't have to interpolate (which takes a *lot*
@@ -2597,15 +3909,68 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
       }
       deltats_tmp.swap(deltats);
     }
-    vector<Quaternion> XiIntegral1(deltats.size());
-    vector<Quaternion> XiIntegral2(deltats.size());
-    for(unsigned int i=0; i<XiIntegral1.size(); ++i) {
-      XiIntegral1[i] = Quaternions::DefiniteIntegral(R_fA
-                                                     *Aligner.Rbar_epsB(t_mid+deltats[i])
-                                                     *Aligner.Rbar_fB(t_A+deltats[i]), t_A);
-      XiIntegral2[i] = Quaternions::DefiniteIntegral(R_fA
-                                                     *(-Quaternions::zHat)*Aligner.Rbar_epsB(t_mid+deltats[i])
-                                                     *Aligner.Rbar_fB(t_A+deltats[i]), t_A);
+
+    // Each deltat is independent of the others, so they are all
+    // evaluated concurrently; the minima are found afterward, in
+    // order, so that the result does not depend on the threading.
+    // With `FFTScan`, the XiIntegrals are found for all deltat at once
+    // by cross-correlation, and the objective function is evaluated
+    // only where |XiIntegral1| and |XiIntegral2| are largest; the
+    // other values are left at 1e300 -- the same as the initial
+    // values of Upsilon -- and so are never chosen.  (Not NaN, which
+    // may not compare reliably under -ffast-math.)
+    const int NDeltats = deltats.size();
+    vector<Quaternion> XiIntegral1(NDeltats);
+    vector<Quaternion> XiIntegral2(NDeltats);
+    vector<vector<Quaternion> > R_delta_logs(NDeltats, vector<Quaternion>(4));
+    vector<vector<double> > Upsilons(NDeltats, vector<double>(4, 1e300));
+    if(FFTScan) {
+      Aligner.XiIntegralsByCorrelation(deltats, XiIntegral1, XiIntegral2);
+    }
+    #pragma omp parallel for schedule(dynamic)
+    for(int i=0; i<NDeltats; ++i) {
+      try {
+        if(!FFTScan) {
+          XiIntegral1[i] = Quaternions::DefiniteIntegral(R_fA
+                                                         *Aligner.Rbar_epsB(t_mid+deltats[i])
+                                                         *Aligner.Rbar_fB(t_A+deltats[i]), t_A);
+          XiIntegral2[i] = Quaternions::DefiniteIntegral(R_fA
+                                                         *(-Quaternions::zHat)*Aligner.Rbar_epsB(t_mid+deltats[i])
+                                                         *Aligner.Rbar_fB(t_A+deltats[i]), t_A);
+        }
+        R_delta_logs[i][0] = Quaternions::logRotor(XiIntegral1[i].normalized());
+        R_delta_logs[i][1] = Quaternions::logRotor(-XiIntegral1[i].normalized());
+        R_delta_logs[i][2] = Quaternions::logRotor(XiIntegral2[i].normalized());
+        R_delta_logs[i][3] = Quaternions::logRotor(-XiIntegral2[i].normalized());
+        if(!FFTScan) {
+          for(unsigned int j=0; j<4; ++j) {
+            Upsilons[i][j] = Aligner.EvaluateMinimizationQuantity(deltats[i], R_delta_logs[i][j][1],
+                                                                  R_delta_logs[i][j][2], R_delta_logs[i][j][3]);
+          }
+        }
+      } catch(int e) {
+        #pragma omp critical(AlignWaveformsError)
+        { Error = e; }
+      } catch(...) { // E.g., std::bad_alloc, which must not escape the parallel region
+        #pragma omp critical(AlignWaveformsError)
+        {
+          INFOTOCERR << "\nError: Unexpected exception while evaluating at deltat=" << deltats[i] << "." << std::endl;
+          Error = GWFrames_FailedSystemCall;
+        }
+      }
+    }
+    if(Error) { throw(Error); }
+    if(FFTScan && NDeltats>0) {
+      int i_1=0, i_2=0;
+      for(int i=1; i<NDeltats; ++i) {
+        if(Quaternions::abs(XiIntegral1[i])>Quaternions::abs(XiIntegral1[i_1])) { i_1 = i; }
+        if(Quaternions::abs(XiIntegral2[i])>Quaternions::abs(XiIntegral2[i_2])) { i_2 = i; }
+      }
+      for(unsigned int j=0; j<4; ++j) {
+        const int i = (j<2 ? i_1 : i_2);
+        Upsilons[i][j] = Aligner.EvaluateMinimizationQuantity(deltats[i], R_delta_logs[i][j][1],
+                                                              R_delta_logs[i][j][2], R_delta_logs[i][j][3]);
+      }
     }
 
     if(Debug) {
@@ -2619,51 +3984,22 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
       XiFile << std::setprecision(15);
     }
 
-    for(unsigned int i=0; i<XiIntegral1.size(); ++i) {
-      const Quaternions::Quaternion R_delta_log1 = Quaternions::logRotor(XiIntegral1[i].normalized());
-      const Quaternions::Quaternion NegativeR_delta_log1 = Quaternions::logRotor(-XiIntegral1[i].normalized());
-      const Quaternions::Quaternion R_delta_log2 = Quaternions::logRotor(XiIntegral2[i].normalized());
-      const Quaternions::Quaternion NegativeR_delta_log2 = Quaternions::logRotor(-XiIntegral2[i].normalized());
-      const double Upsilon0 = Aligner.EvaluateMinimizationQuantity(deltats[i], R_delta_log1[1], R_delta_log1[2], R_delta_log1[3]);
-      const double Upsilon1 = Aligner.EvaluateMinimizationQuantity(deltats[i], NegativeR_delta_log1[1],
-                                                                   NegativeR_delta_log1[2], NegativeR_delta_log1[3]);
-      const double Upsilon2 = Aligner.EvaluateMinimizationQuantity(deltats[i], R_delta_log2[1], R_delta_log2[2], R_delta_log2[3]);
-      const double Upsilon3 = Aligner.EvaluateMinimizationQuantity(deltats[i], NegativeR_delta_log2[1],
-                                                                   NegativeR_delta_log2[2], NegativeR_delta_log2[3]);
-      if(Upsilon0<Upsilon[0]) {
-        Upsilon[0] = Upsilon0;
-        optima[0][0] = deltats[i];
-        optima[0][1] = R_delta_log1[1];
-        optima[0][2] = R_delta_log1[2];
-        optima[0][3] = R_delta_log1[3];
-      }
-      if(Upsilon1<Upsilon[1]) {
-        Upsilon[1] = Upsilon1;
-        optima[1][0] = deltats[i];
-        optima[1][1] = NegativeR_delta_log1[1];
-        optima[1][2] = NegativeR_delta_log1[2];
-        optima[1][3] = NegativeR_delta_log1[3];
-      }
-      if(Upsilon2<Upsilon[2]) {
-        Upsilon[2] = Upsilon2;
-        optima[2][0] = deltats[i];
-        optima[2][1] = R_delta_log2[1];
-        optima[2][2] = R_delta_log2[2];
-        optima[2][3] = R_delta_log2[3];
-      }
-      if(Upsilon3<Upsilon[3]) {
-        Upsilon[3] = Upsilon3;
-        optima[3][0] = deltats[i];
-        optima[3][1] = NegativeR_delta_log2[1];
-        optima[3][2] = NegativeR_delta_log2[2];
-        optima[3][3] = NegativeR_delta_log2[3];
+    for(int i=0; i<NDeltats; ++i) {
+      for(unsigned int j=0; j<4; ++j) {
+        if(Upsilons[i][j]<Upsilon[j]) {
+          Upsilon[j] = Upsilons[i][j];
+          optima[j][0] = deltats[i];
+          optima[j][1] = R_delta_logs[i][j][1];
+          optima[j][2] = R_delta_logs[i][j][2];
+          optima[j][3] = R_delta_logs[i][j][3];
+        }
       }
       if(Debug) {
         XiFile << deltats[i] << " "
                << 2*(t_2 - t_1 - Quaternions::abs(XiIntegral1[i])) << " "
                << 2*(t_2 - t_1 - Quaternions::abs(XiIntegral2[i])) << " "
                << XiIntegral1[i].str() << " " << XiIntegral2[i].str() << " "
-               << Upsilon0 << " " << Upsilon1 << " " << Upsilon2 << " " << Upsilon3
+               << Upsilons[i][0] << " " << Upsilons[i][1] << " " << Upsilons[i][2] << " " << Upsilons[i][3]
                << std::endl;
       }
     }
@@ -2679,11 +4015,11 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
                  << "," << optima[j][3] << "]) = " << Upsilon[j] << std::endl;
     }
 
-
+    Statistics.ScanEvaluations = NDeltats;
   }
 
-  gettimeofday(&now, NULL); unsigned long long tThen = now.tv_usec + (unsigned long long)now.tv_sec * 1000000;
-  INFOTOCOUT << "First stage took " << (tThen-tNow)/1000000.0L << " seconds." << std::endl;
+  const double tScan = WallTime();
+  Statistics.ScanTime = tScan-tStart;
 
   { // Decide which of the four possible minima to test further
     const double Upsilon_max = std::max(std::max(std::max(Upsilon[0], Upsilon[1]), Upsilon[2]), Upsilon[3]);
@@ -2695,99 +4031,69 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
 
   // Next, minimize algorithmically, in four dimensions, accounting
   // for all adjustments in generality.  This is very slow, but we've
-  // gotten a very good initial guess from the dumb way above.
-  std::vector<double> difference_norm(4, 1e300);
-  size_t iter_tot = 0;
-  for(unsigned int branch_choice=0; branch_choice<4; ++branch_choice) {
-    if(try_branch[branch_choice]) {
-      const unsigned int NDimensions = 4;
-      const unsigned int MaxIterations = 2000;
-      const double MinSimplexSize = 2.0e-9;
-      const double InitialTrialTimeStep = std::max(W_A.T(1)-W_A.T(0), W_B.T(1)-W_B.T(0))/2.;
-      const double InitialTrialAngleStep = 1.0/(t_2-t_1);
-
-      // Use Nelder-Mead simplex minimization
-      const gsl_multimin_fminimizer_type* T =
-        gsl_multimin_fminimizer_nmsimplex2;
-      gsl_multimin_fminimizer* s = NULL;
-      gsl_vector* ss;
-      gsl_vector* x;
-      gsl_multimin_function min_func;
-      size_t iter = 0;
-      int status = GSL_CONTINUE;
-      double size = 0.0;
-
-      // Set initial values
-      x = gsl_vector_alloc(NDimensions);
-      for(unsigned int j=0; j<NDimensions; ++j) {
-        gsl_vector_set(x, j, optima[branch_choice][j]);
-      }
-
-      // Set initial step sizes
-      ss = gsl_vector_alloc(NDimensions);
-      gsl_vector_set(ss, 0, InitialTrialTimeStep);
-      gsl_vector_set(ss, 1, InitialTrialAngleStep);
-      gsl_vector_set(ss, 2, InitialTrialAngleStep);
-      gsl_vector_set(ss, 3, InitialTrialAngleStep);
-
-      min_func.n = NDimensions;
-      min_func.f = &minfunc;
-      min_func.params = (void*) &Aligner;
-
-      s = gsl_multimin_fminimizer_alloc(T, NDimensions);
-      gsl_multimin_fminimizer_set(s, &min_func, x, ss);
-
-      // Run the minimization
-      while(status == GSL_CONTINUE && iter < MaxIterations) {
-        iter++;
-        status = gsl_multimin_fminimizer_iterate(s);
-
-        if(status==GSL_EBADFUNC) {
-          INFOTOCERR << "\nThe iteration encountered a singular point where the function evaluated to Inf or NaN"
-                     << "\nwhile minimizing at (" << gsl_vector_get(s->x, 0) << ", " << gsl_vector_get(s->x, 1)
-                     << ", " << gsl_vector_get(s->x, 2) << ", " << gsl_vector_get(s->x, 3) << ")." << std::endl;
-        }
-
-        if(status==GSL_FAILURE) {
-          INFOTOCERR << "\nThe algorithm could not improve the current best approximation or bounding interval." << std::endl;
+  // gotten a very good initial guess from the dumb way above.  The
+  // branches are independent, so they are minimized concurrently.
+  {
+    const double InitialTrialTimeStep = std::max(W_A.T(1)-W_A.T(0), W_B.T(1)-W_B.T(0))/2.;
+    const double InitialTrialAngleStep = 1.0/(t_2-t_1);
+    const double MinGradient = 2.0e-9*(t_2-t_1);
+    std::vector<unsigned int> Branches;
+    for(unsigned int branch_choice=0; branch_choice<4; ++branch_choice) {
+      if(try_branch[branch_choice]) { Branches.push_back(branch_choice); }
+    }
+    std::vector<int> Status(4, GSL_SUCCESS);
+    #pragma omp parallel for schedule(dynamic,1)
+    for(int i_branch=0; i_branch<int(Branches.size()); ++i_branch) {
+      const unsigned int branch_choice = Branches[i_branch];
+      const double tBranch = WallTime();
+      try {
+        Statistics.BranchIterations[branch_choice]
+          = MinimizeUpsilon(Aligner, GradientOptimizer, InitialTrialTimeStep, InitialTrialAngleStep, MinGradient,
+                            optima[branch_choice], Upsilon[branch_choice], Status[branch_choice]);
+      } catch(int e) {
+        #pragma omp critical(AlignWaveformsError)
+        { Error = e; }
+      } catch(...) { // E.g., std::bad_alloc, which must not escape the parallel region
+        #pragma omp critical(AlignWaveformsError)
+        {
+          INFOTOCERR << "\nError: Unexpected exception while minimizing branch_choice=" << branch_choice << "." << std::endl;
+          Error = GWFrames_FailedSystemCall;
         }
+      }
+      Statistics.BranchTimes[branch_choice] = WallTime()-tBranch;
+    }
+    if(Error) { throw(Error); }
 
-        if(status==GSL_ENOPROG) {
-          INFOTOCERR << "\nThe minimizer is unable to improve on its current estimate, either due to"
-                     << "\nnumerical difficulty or because a genuine local minimum has been reached." << std::endl;
-        }
+    for(unsigned int i_branch=0; i_branch<Branches.size(); ++i_branch) {
+      const unsigned int branch_choice = Branches[i_branch];
+      const std::vector<double>& x = optima[branch_choice];
 
-        if(status) break;
-        size = gsl_multimin_fminimizer_size(s);
-        status = gsl_multimin_test_size(size, MinSimplexSize);
+      if(Status[branch_choice]==GSL_EBADFUNC) {
+        INFOTOCERR << "\nThe iteration encountered a singular point where the function evaluated to Inf or NaN"
+                   << "\nwhile minimizing at (" << x[0] << ", " << x[1] << ", " << x[2] << ", " << x[3] << ")." << std::endl;
       }
 
-      iter_tot += iter;
-
-      if(iter==MaxIterations) {
-        INFOTOCERR << "\nWarning: Minimization ended because it went through " << MaxIterations << " iterations."
-                   << "\n         This may indicate failure.  You may want to try with a better initial guess." << std::endl;
+      if(Status[branch_choice]==GSL_FAILURE) {
+        INFOTOCERR << "\nThe algorithm could not improve the current best approximation or bounding interval." << std::endl;
       }
 
-      // Get time shift and rotation
-      for(unsigned int j=0; j<NDimensions; ++j) {
-        optima[branch_choice][j] = gsl_vector_get(s->x, j);
+      if(Status[branch_choice]==GSL_ENOPROG) {
+        INFOTOCERR << "\nThe minimizer is unable to improve on its current estimate, either due to"
+                   << "\nnumerical difficulty or because a genuine local minimum has been reached." << std::endl;
       }
 
-      // Get value of objective function here
-      Upsilon[branch_choice] = s->fval;
+      if(Status[branch_choice]==GSL_EMAXITER) {
+        INFOTOCERR << "\nWarning: Minimization ended because it went through " << Statistics.BranchIterations[branch_choice] << " iterations."
+                   << "\n         This may indicate failure.  You may want to try with a better initial guess." << std::endl;
+      }
 
       INFOTOCOUT << "Objective function value for branch_choice=" << branch_choice
-                 << " after " << iter << " iterations:\n";
-      INFOTOCOUT << "\tUpsilon(deltat=" << optima[branch_choice][0] << ", r_delta=[" << optima[branch_choice][1]
-                 << "," << optima[branch_choice][2] << "," << optima[branch_choice][3] << "]) = " << Upsilon[branch_choice] << std::endl;
-
-      // Free allocated memory
-      gsl_vector_free(x);
-      gsl_vector_free(ss);
-      gsl_multimin_fminimizer_free(s);
+                 << " after " << Statistics.BranchIterations[branch_choice] << " iterations:\n";
+      INFOTOCOUT << "\tUpsilon(deltat=" << x[0] << ", r_delta=[" << x[1]
+                 << "," << x[2] << "," << x[3] << "]) = " << Upsilon[branch_choice] << std::endl;
     }
   }
+  Statistics.BranchUpsilon = Upsilon;
 
   {  // Decide on the best choice of branch
     const double Upsilon_max = std::max(std::max(std::max(Upsilon[0], Upsilon[1]), Upsilon[2]), Upsilon[3]);
@@ -2808,13 +4114,97 @@ void GWFrames::AlignWaveforms(GWFrames::Waveform& W_A, GWFrames::Waveform& W_B,
     W_B.SetTime(W_B.T()-deltat);
     W_B.RotateDecompositionBasis(R_eps);
     W_B.SetFrame(R_delta*W_B.Frame());
+  }
 
-    gettimeofday(&now, NULL); unsigned long long tWhen = now.tv_usec + (unsigned long long)now.tv_sec * 1000000;
-    INFOTOCOUT << "Second stage took " << (tWhen-tThen)/1000000.0L
-               << " seconds with " << iter_tot << " iterations." << std::endl;
+  const double tEnd = WallTime();
+  Statistics.OptimizationTime = tEnd-tScan;
+  Statistics.TotalTime = tEnd-tStart;
+  unsigned int iter_tot = 0;
+  for(unsigned int j=0; j<4; ++j) {
+    iter_tot += Statistics.BranchIterations[j];
+  }
+  INFOTOCOUT << "First stage took " << Statistics.ScanTime << " seconds for " << Statistics.ScanEvaluations
+             << " values of deltat.\n";
+  std::stringstream BranchBreakdown;
+  for(unsigned int j=0; j<4; ++j) {
+    if(Statistics.BranchIterations[j]>0) {
+      BranchBreakdown << "\n\tbranch_choice=" << j << ": " << Statistics.BranchIterations[j]
+                      << " iterations in " << Statistics.BranchTimes[j] << " seconds";
+    }
   }
+  INFOTOCOUT << "Second stage took " << Statistics.OptimizationTime << " seconds with " << iter_tot << " iterations:"
+             << BranchBreakdown.str() << std::endl;
 
-  return;
+  return Statistics;
+}
+
+/// Align many pairs of waveforms, concurrently
+std::vector<GWFrames::AlignWaveformsStatistics> GWFrames::AlignWaveformsBatch(const std::vector<GWFrames::Waveform>& As,
+                                                                             const std::vector<GWFrames::Waveform>& Bs,
+                                                                             const std::vector<double>& t_1s, const std::vector<double>& t_2s,
+                                                                             std::vector<GWFrames::Waveform>& AlignedAs,
+                                                                             std::vector<GWFrames::Waveform>& AlignedBs,
+                                                                             unsigned int InitialEvaluations, const bool GradientOptimizer,
+                                                                             const bool FFTScan)
+{
+  /// \param As Fixed waveforms
+  /// \param Bs Adjusted waveforms
+  /// \param t_1s Beginning of alignment interval for each pair
+  /// \param t_2s End of alignment interval for each pair
+  /// \param AlignedAs Output copies of `As`, with modes re-aligned
+  /// \param AlignedBs Output copies of `Bs`, with modes re-aligned and frame and time offset
+  /// \param InitialEvaluations Number of evaluations for dumb initial optimization
+  /// \param GradientOptimizer Use BFGS with the gradient of the objective function [default: false]
+  /// \param FFTScan Find the initial guess by cross-correlation [default: false]
+  ///
+  /// This is equivalent to copying `As[i]` and `Bs[i]` into
+  /// `AlignedAs[i]` and `AlignedBs[i]`, and calling
+  /// `AlignWaveforms(AlignedAs[i], AlignedBs[i], t_1s[i], t_2s[i],
+  /// ...)` on the copies for each `i`, except that the pairs are
+  /// distributed among OpenMP threads.  Each pair is aligned within a
+  /// single thread (OpenMP regions inside `AlignWaveforms` run
+  /// serially when nested), so this is the efficient way to align a
+  /// large catalog.  In python, the GIL is released for the duration
+  /// of this call.
+  ///
+  /// An error while aligning one pair does not stop the others; its
+  /// code is stored in the `Error` member of that pair's statistics,
+  /// and the aligned Waveforms of that pair should not be used.
+
+  const int NPairs = As.size();
+  if(Bs.size()!=As.size() || t_1s.size()!=As.size() || t_2s.size()!=As.size()) {
+    std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": As.size()=" << As.size() << "; Bs.size()=" << Bs.size()
+              << "; t_1s.size()=" << t_1s.size() << "; t_2s.size()=" << t_2s.size()
+              << "\nThese should all be equal." << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  std::vector<AlignWaveformsStatistics> Statistics(NPairs);
+  AlignedAs.resize(NPairs);
+  AlignedBs.resize(NPairs);
+  #pragma omp parallel for schedule(dynamic,1)
+  for(int i=0; i<NPairs; ++i) {
+    try {
+      AlignedAs[i] = As[i];
+      AlignedBs[i] = Bs[i];
+      Statistics[i] = AlignWaveforms(AlignedAs[i], AlignedBs[i], t_1s[i], t_2s[i], InitialEvaluations, std::vector<double>(0), false,
+                                     GradientOptimizer, FFTScan);
+    } catch(int e) {
+      Statistics[i].Error = e;
+      #pragma omp critical(AlignWaveformsBatchOutput)
+      {
+        INFOTOCERR << "\nError " << e << " while aligning pair " << i << "; continuing with the others." << std::endl;
+      }
+    } catch(...) { // E.g., std::bad_alloc, which must not escape the parallel region
+      Statistics[i].Error = GWFrames_FailedSystemCall;
+      #pragma omp critical(AlignWaveformsBatchOutput)
+      {
+        INFOTOCERR << "\nUnexpected exception while aligning pair " << i << "; continuing with the others." << std::endl;
+      }
+    }
+  }
+
+  return Statistics;
 }
 
 /// Return a Waveform with differences between the two inputs.
@@ -2863,6 +4253,7 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
   // We'll assume that {A.lm}=={B.lm} as sets, and account for
   // disordering below
   C.lm = A.lm;
+  C.lmIndex = A.lmIndex;
 
   // Process the frame, depending on the sizes of the input frames
   if(A.Frame().size()>1 && B.Frame().size()>1) {
@@ -2917,52 +4308,33 @@ GWFrames::Waveform GWFrames::Waveform::Compare(const GWFrames::Waveform& A, cons
 
   // Reserve space for the data
   C.data.resize(C.lm.size(), C.t.size());
-  // Construct the GSL interpolators for the data
-  gsl_interp_accel* accReA = gsl_interp_accel_alloc();
-  gsl_interp_accel* accImA = gsl_interp_accel_alloc();
-  gsl_interp_accel* accReB = gsl_interp_accel_alloc();
-  gsl_interp_accel* accImB = gsl_interp_accel_alloc();
-  gsl_spline* splineReA = gsl_spline_alloc(gsl_interp_cspline, A.NTimes());
-  gsl_spline* splineImA = gsl_spline_alloc(gsl_interp_cspline, A.NTimes());
-  gsl_spline* splineReB = gsl_spline_alloc(gsl_interp_cspline, B.NTimes());
-  gsl_spline* splineImB = gsl_spline_alloc(gsl_interp_cspline, B.NTimes());
+  // Construct the splines for the data, and the weights for the new times
+  const WaveformSpline SplineA(A), SplineB(B);
+  const WaveformSpline::Stencil SA = SplineA.StencilAt(C.t);
+  const WaveformSpline::Stencil SB = SplineB.StencilAt(C.t);
 
-  // Now loop over each mode filling in the waveform data
+  // Assume that all the ell,m data are the same, but not necessarily in the same order
+  vector<unsigned int> BModes(A.NModes());
   for(unsigned int Mode=0; Mode<A.NModes(); ++Mode) {
-    // Assume that all the ell,m data are the same, but not necessarily in the same order
-    const unsigned int BMode = B.FindModeIndex(A.lm[Mode][0], A.lm[Mode][1]);
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> ReA = A.Re(Mode);
-    const vector<double> ImA = A.Im(Mode);
-    const vector<double> ReB = B.Re(BMode);
-    const vector<double> ImB = B.Im(BMode);
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineReA, &(A.t)[0], &ReA[0], A.NTimes());
-    gsl_spline_init(splineImA, &(A.t)[0], &ImA[0], A.NTimes());
-    gsl_spline_init(splineReB, &(B.t)[0], &ReB[0], B.NTimes());
-    gsl_spline_init(splineImB, &(B.t)[0], &ImB[0], B.NTimes());
-    // Assign the data from the transition
-    for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
-      C.data[Mode][i_t] = complex<double>( gsl_spline_eval(splineReA, C.t[i_t], accReA), gsl_spline_eval(splineImA, C.t[i_t], accImA) )
-        - complex<double>( gsl_spline_eval(splineReB, C.t[i_t], accReB), gsl_spline_eval(splineImB, C.t[i_t], accImB) );
-    }
-    gsl_interp_accel_reset(accReA);
-    gsl_interp_accel_reset(accImA);
-    gsl_interp_accel_reset(accReB);
-    gsl_interp_accel_reset(accImB);
+    BModes[Mode] = B.FindModeIndex(A.lm[Mode][0], A.lm[Mode][1]);
   }
 
-  gsl_interp_accel_free(accReA);
-  gsl_interp_accel_free(accImA);
-  gsl_interp_accel_free(accReB);
-  gsl_interp_accel_free(accImB);
-  gsl_spline_free(splineReA);
-  gsl_spline_free(splineImA);
-  gsl_spline_free(splineReB);
-  gsl_spline_free(splineImB);
-
-  return C;
-}
+  // Now loop over each mode filling in the waveform data
+  #pragma omp parallel if(A.NModes()>1 && C.NTimes()>ParallelTimeThreshold)
+  {
+    vector<complex<double> > DataB(C.NTimes());
+    #pragma omp for
+    for(int Mode=0; Mode<int(A.NModes()); ++Mode) {
+      SplineA.EvaluateMode(Mode, SA, C.data[Mode]);
+      SplineB.EvaluateMode(BModes[Mode], SB, DataB.data());
+      for(unsigned int i_t=0; i_t<C.t.size(); ++i_t) {
+        C.data[Mode][i_t] -= DataB[i_t];
+      }
+    }
+  }
+
+  return C;
+}
 
 /// Local utility function
 inline double TransitionFunction_Smooth(const double x) {
@@ -2990,10 +4362,99 @@ GWFrames::Waveform GWFrames::Waveform::Hybridize(const GWFrames::Waveform& B, co
   /// in between.
   ///
   /// Note that this function does NOT operate in place; a new
-  /// Waveform object is constructed and returned.
+  /// Waveform object is constructed and returned.  To hybridize many
+  /// Waveforms with the same `B`, use a `Hybridizer` directly.
+  ///
+  /// \sa Hybridizer
+
+  return GWFrames::Hybridizer(B, t, t1, t2, tMinStep).Hybridize(*this);
+}
+
+/// Precompute everything needed to hybridize Waveforms with times TA with the Waveform B
+GWFrames::Hybridizer::Hybridizer(const GWFrames::Waveform& iB, const std::vector<double>& iTA,
+                                 const double it1, const double it2, const double itMinStep)
+  : B(iB.CopyWithoutData()), t1(it1), t2(it2), tMinStep(itMinStep), TA(iTA), t(), J01(0), J12(0),
+    Transition(), SA(), Bframe(), Bdata()
+{
+  /// \param iB Late Waveform, which will be used for every hybrid
+  /// \param iTA Times of the early Waveforms to be hybridized
+  /// \param it1 Beginning of time over which to transition
+  /// \param it2 End of time over which to transition
+  /// \param itMinStep Lower limit on time step appearing in the output
+
+  // Keep just the information about B needed to check and label the hybrids
+  B.history.str(iB.history.str());
+  B.history.clear();
+  B.history.seekp(0, ios_base::end);
+  B.t = iB.t;
+  B.lm = iB.lm;
+  B.lmIndex = iB.lmIndex;
+
+  // Make sure we have sufficient times for the requested hybrid
+  if(t1>=t2) {
+    INFOTOCERR << "\nError: The transition must begin before it ends; t1=" << t1 << "\tt2=" << t2 << std::endl;
+    throw(GWFrames_ValueError);
+  }
+  if(TA.size()<2 || iB.NTimes()<2 || t1<TA[0] || t1<iB.t[0] || t2>TA.back() || t2>iB.t.back()) {
+    INFOTOCERR << ": These Waveforms do not overlap on the requested range."
+               << "\nA.T(0)=" << (TA.size()>0 ? TA[0] : 0.0) << "\tB.T(0)" << (iB.NTimes()>0 ? iB.t[0] : 0.0) << "\tt1=" << t1
+               << "\nA.T(-1)=" << (TA.size()>0 ? TA.back() : 0.0) << "\tB.T(-1)" << (iB.NTimes()>0 ? iB.t.back() : 0.0)
+               << "\tt2=" << t2 << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+
+  // The output times are the union of the two sets of times...
+  t = GWFrames::Union(TA, iB.t, tMinStep);
+  // ...stopping at the end of B's time (in case A extended further)
+  int i_t=t.size()-1;
+  while(t[i_t]>iB.t.back() && i_t>0) { --i_t; }
+  t.erase(t.begin()+i_t, t.end());
+  const unsigned int N = t.size();
+
+  // Find the indices of the transition points, and the blending weights
+  J01 = 0;
+  J12 = N-1;
+  while(J01<N && t[J01]<t1) { J01++; }
+  while(t[J12]>t2 && J12>0) { J12--; }
+  if(J12<=J01) {
+    INFOTOCERR << "\nError: The transition from t1=" << t1 << " to t2=" << t2 << " contains fewer than two output times."
+               << "\n       Widen the transition, or decrease tMinStep=" << tMinStep << "." << std::endl;
+    throw(GWFrames_ValueError);
+  }
+  const double T01 = t[J01];
+  const double TransitionLength = t[J12]-T01;
+  Transition.resize(J12-J01);
+  for(unsigned int j=J01; j<J12; ++j) {
+    Transition[j-J01] = TransitionFunction_Smooth((t[j]-T01)/TransitionLength);
+  }
 
-  // Make A a convenient alias
-  const GWFrames::Waveform& A = *this;
+  // B is needed after the beginning of the transition
+  Bframe = GWFrames::RotorTimeSeries(iB.frame, iB.t).Evaluate(std::vector<double>(t.begin()+J01, t.end()));
+  {
+    const WaveformSpline SplineB(iB);
+    const WaveformSpline::Stencil SB = SplineB.StencilAt(&t[J01], N-J01);
+    Bdata.resize(iB.NModes(), N-J01);
+    #pragma omp parallel for if(iB.NModes()>1 && N>ParallelTimeThreshold)
+    for(int i_m=0; i_m<int(iB.NModes()); ++i_m) {
+      SplineB.EvaluateMode(i_m, SB, Bdata[i_m]);
+    }
+  }
+
+  // A is needed before the end of the transition.  The weights
+  // depend only on the times, so a spline with no modes will do.
+  {
+    Waveform Reference;
+    Reference.t = TA;
+    SA = WaveformSpline(Reference).StencilAt(&t[0], J12);
+  }
+}
+
+/// Hybridize the Waveform A with the late Waveform given on construction
+GWFrames::Waveform GWFrames::Hybridizer::Hybridize(const GWFrames::Waveform& A) const {
+  /// \param A Early Waveform
+  ///
+  /// The output has exactly `A`'s data before `t1`, exactly the late
+  /// Waveform's data after `t2`, and a smooth blend in between.
 
   // Check to see if the various type flags agree
   if(A.spinweight != B.spinweight) {
@@ -3040,24 +4501,26 @@ GWFrames::Waveform GWFrames::Waveform::Hybridize(const GWFrames::Waveform& B, co
   }
 
   // Make sure we have the same number of modes in the input data
-  if(NModes() != B.NModes()) {
+  if(A.NModes() != B.lm.size()) {
     std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Trying to Align Waveforms with mismatched LM data."
-              << "\nA.NModes()=" << A.NModes() << "\tB.NModes()=" << B.NModes() << std::endl;
+              << "\nA.NModes()=" << A.NModes() << "\tB.NModes()=" << B.lm.size() << std::endl;
     throw(GWFrames_WaveformMissingLMIndex);
   }
 
-  // Make sure we have sufficient times for the requested hybrid
-  {
-    const double t1A = A.T(0);
-    const double t1B = B.T(0);
-    const double t2A = A.T(A.NTimes()-1);
-    const double t2B = B.T(B.NTimes()-1);
-    if(t1<t1A || t1<t1B || t2>t2A || t2>t2B) {
-      INFOTOCERR << ": These Waveforms do not overlap on the requested range."
-                 << "\nA.T(0)=" << t1A << "\tB.T(0)" << t1B << "\tt1=" << t1
-                 << "\nA.T(-1)=" << t2A << "\tB.T(-1)" << t2B << "\tt2=" << t2 << std::endl;
-      throw(GWFrames_EmptyIntersection);
-    }
+  // A Waveform with other times is interpolated to the same output
+  // times, so it must cover them
+  const bool SameTimes = (A.t==TA);
+  if(!SameTimes && (A.NTimes()<2 || A.t[0]>t[0] || (J12>0 && A.t.back()<t[J12-1]))) {
+    INFOTOCERR << ": This Waveform does not cover the times needed for the hybrid."
+               << "\nA.T(0)=" << (A.NTimes()>0 ? A.t[0] : 0.0) << "\tt[0]=" << t[0]
+               << "\nA.T(-1)=" << (A.NTimes()>0 ? A.t.back() : 0.0) << "\tt2=" << t2 << std::endl;
+    throw(GWFrames_EmptyIntersection);
+  }
+
+  // Assume that all the ell,m data are the same, but not necessarily in the same order
+  vector<unsigned int> BModes(A.NModes());
+  for(unsigned int Mode=0; Mode<A.NModes(); ++Mode) {
+    BModes[Mode] = B.FindModeIndex(A.lm[Mode][0], A.lm[Mode][1]);
   }
 
   // We'll put all the data in a new Waveform C
@@ -3073,84 +4536,46 @@ GWFrames::Waveform GWFrames::Waveform::Hybridize(const GWFrames::Waveform& B, co
             << "#### B.history.str():\n" << B.history.str()
             << "#### End of old histories from `Hybridize`" << std::endl;
   C.versionHist = A.versionHist;
-  C.t = GWFrames::Union(A.t, B.t, tMinStep);
-  // We'll assume that A.lm==B.lm, though we'll account for disordering below
+  C.t = t;
+  // We'll assume that A.lm==B.lm, though we accounted for disordering above
   C.lm = A.lm;
-  // Make sure the time stops at the end of B's time (in case A extended further)
-  int i_t=C.t.size()-1;
-  while(C.T(i_t)>B.t.back() && i_t>0) { --i_t; }
-  C.t.erase(C.t.begin()+i_t, C.t.end());
-  // Reserve space for everything
-  C.frame.resize(C.NTimes());
-  C.data.resize(C.lm.size(), C.t.size());
-  // Find the indices of the transition points
-  unsigned int J01=0, J12=C.NTimes()-1;
-  while(C.T(J01)<t1 && J01<C.NTimes()) { J01++; }
-  while(C.T(J12)>t2 && J12>0) { J12--; }
-  const double T01 = C.T(J01);
-  const double TransitionLength = C.T(J12)-T01;
-  // Find the frames interpolated to the appropriate times
-  vector<Quaternion> Aframe = Quaternions::Squad(A.frame, A.t, vector<double>(&(C.t)[0], &(C.t)[J12]));
-  vector<Quaternion> Bframe = Quaternions::Squad(B.frame, B.t, vector<double>(&(C.t)[J01], &(C.t)[C.NTimes()-1]));
-  // Assign the frame data from earliest part
+  C.lmIndex = A.lmIndex;
+  const unsigned int N = t.size();
+  C.frame.resize(N);
+  C.data.resize(C.lm.size(), N);
+
+  // Blend the frames
+  const vector<Quaternion> Aframe = GWFrames::RotorTimeSeries(A.frame, A.t).Evaluate(std::vector<double>(t.begin(), t.begin()+J12));
   for(unsigned int j=0; j<J01; ++j) {
     C.frame[j] = Aframe[j];
   }
-  // Assign the frame data from the transition
   for(unsigned int j=J01; j<J12; ++j) {
-    const double Transition = TransitionFunction_Smooth((C.T(j)-T01)/TransitionLength);
-    C.frame[j] = Quaternions::Slerp(Transition, Aframe[j], Bframe[j-J01]);
+    C.frame[j] = Quaternions::Slerp(Transition[j-J01], Aframe[j], Bframe[j-J01]);
   }
-  // Assign the frame data from the latest part
-  for(unsigned int j=J12; j<C.NTimes(); ++j) {
+  for(unsigned int j=J12; j<N; ++j) {
     C.frame[j] = Bframe[j-J01];
   }
-  // Construct the GSL interpolators for the data
-  gsl_interp_accel* accReA = gsl_interp_accel_alloc();
-  gsl_interp_accel* accImA = gsl_interp_accel_alloc();
-  gsl_interp_accel* accReB = gsl_interp_accel_alloc();
-  gsl_interp_accel* accImB = gsl_interp_accel_alloc();
-  gsl_spline* splineReA = gsl_spline_alloc(gsl_interp_cspline, A.NTimes());
-  gsl_spline* splineImA = gsl_spline_alloc(gsl_interp_cspline, A.NTimes());
-  gsl_spline* splineReB = gsl_spline_alloc(gsl_interp_cspline, B.NTimes());
-  gsl_spline* splineImB = gsl_spline_alloc(gsl_interp_cspline, B.NTimes());
-  // Now loop over each mode filling in the waveform data
-  for(unsigned int Mode=0; Mode<A.NModes(); ++Mode) {
-    // Assume that all the ell,m data are the same, but not necessarily in the same order
-    const unsigned int BMode = B.FindModeIndex(A.lm[Mode][0], A.lm[Mode][1]);
-    // Extract the real and imaginary parts of the data separately for GSL
-    const vector<double> ReA = A.Re(Mode);
-    const vector<double> ImA = A.Im(Mode);
-    const vector<double> ReB = B.Re(BMode);
-    const vector<double> ImB = B.Im(BMode);
-    // Initialize the interpolators for this data set
-    gsl_spline_init(splineReA, &(A.t)[0], &ReA[0], A.NTimes());
-    gsl_spline_init(splineImA, &(A.t)[0], &ImA[0], A.NTimes());
-    gsl_spline_init(splineReB, &(B.t)[0], &ReB[0], B.NTimes());
-    gsl_spline_init(splineImB, &(B.t)[0], &ImB[0], B.NTimes());
-    // Assign the data from earliest part
-    for(unsigned int j=0; j<J01; ++j) {
-      C.data[Mode][j] = complex<double>( gsl_spline_eval(splineReA, C.t[j], accReA), gsl_spline_eval(splineImA, C.t[j], accImA) );
-    }
-    // Assign the data from the transition
+
+  // Fit the spline for A, and blend the data in one pass over each mode
+  const WaveformSpline SplineA(A);
+  WaveformSpline::Stencil SAOther;
+  if(!SameTimes) { SAOther = SplineA.StencilAt(&t[0], J12); }
+  const WaveformSpline::Stencil& S = (SameTimes ? SA : SAOther);
+  #pragma omp parallel for if(A.NModes()>1 && N>ParallelTimeThreshold)
+  for(int Mode=0; Mode<int(A.NModes()); ++Mode) {
+    const complex<double>* DataB = Bdata[BModes[Mode]];
+    complex<double>* DataC = C.data[Mode];
+    // Assign the data from the earliest part and the transition
+    SplineA.EvaluateMode(Mode, S, DataC);
+    // Blend the data in the transition
     for(unsigned int j=J01; j<J12; ++j) {
-      const double Transition = TransitionFunction_Smooth((C.T(j)-T01)/TransitionLength);
-      C.data[Mode][j] = complex<double>( gsl_spline_eval(splineReA, C.t[j], accReA), gsl_spline_eval(splineImA, C.t[j], accImA) ) * (1.0-Transition)
-        + complex<double>( gsl_spline_eval(splineReB, C.t[j], accReB), gsl_spline_eval(splineImB, C.t[j], accImB) ) * Transition ;
+      DataC[j] = DataC[j] * (1.0-Transition[j-J01]) + DataB[j-J01] * Transition[j-J01];
     }
     // Assign the data from the latest part
-    for(unsigned int j=J12; j<C.NTimes(); ++j) {
-      C.data[Mode][j] = complex<double>( gsl_spline_eval(splineReB, C.t[j], accReB), gsl_spline_eval(splineImB, C.t[j], accImB) );
+    for(unsigned int j=J12; j<N; ++j) {
+      DataC[j] = DataB[j-J01];
     }
   }
-  gsl_interp_accel_free(accReA);
-  gsl_interp_accel_free(accImA);
-  gsl_interp_accel_free(accReB);
-  gsl_interp_accel_free(accImB);
-  gsl_spline_free(splineReA);
-  gsl_spline_free(splineImA);
-  gsl_spline_free(splineReB);
-  gsl_spline_free(splineImB);
 
   return C;
 }
@@ -3197,33 +4622,157 @@ std::vector<std::complex<double> > GWFrames::Waveform::EvaluateAtPoint(const dou
 
   vector<complex<double> > d(i_1-i_0, complex<double>(0.,0.)); // Be sure to initialize to 0.0
   const Quaternions::Quaternion R_thetaphi(vartheta, varphi);
-  SphericalFunctions::SWSH Y(SpinWeight()); // Y can be evaluated in terms of a unit quaternion
+  const int n_t = i_1-int(i_0);
 
   if(frame.size()<2) {
+    SphericalFunctions::SWSH Y(SpinWeight()); // Y can be evaluated in terms of a unit quaternion
     if(frame.size()==0) {
       Y.SetRotation(R_thetaphi);
     } else { // frame.size()==1
       Y.SetRotation(frame[0].inverse()*R_thetaphi);
     }
+    vector<complex<double> > Ylm(NM);
     for(int i_m=0; i_m<NM; ++i_m) {
-      const int ell = LM(i_m)[0];
-      const int m   = LM(i_m)[1];
-      const complex<double> Ylm = Y(ell,m);
+      Ylm[i_m] = Y(LM(i_m)[0], LM(i_m)[1]);
+    }
+    // This is just the product of a row vector of Ylms with the
+    // (NModes x n_t) block of data
+    ComplexMatrixProduct(1, n_t, NM, Ylm.data(), NM, data[0]+i_0, data.stride(), d.data(), n_t);
+  } else {
+    #pragma omp parallel if(n_t>ParallelTimeThreshold)
+    {
+      SphericalFunctions::SWSH Y(SpinWeight()); // Each thread needs its own Y
+      #pragma omp for schedule(static)
       for(int i_t=i_0; i_t<i_1; ++i_t) {
-        d[i_t-i_0] += Data(i_m, i_t) * Ylm;
+        Y.SetRotation(frame[i_t].inverse()*R_thetaphi);
+        for(int i_m=0; i_m<NM; ++i_m) {
+          const int ell = LM(i_m)[0];
+          const int m   = LM(i_m)[1];
+          d[i_t-i_0] += Data(i_m, i_t) * Y(ell,m);
+        }
       }
     }
-  } else {
-    for(unsigned int i_t=i_0; i_t<i_1; ++i_t) {
-      Y.SetRotation(frame[i_t].inverse()*R_thetaphi);
+  }
+
+  return d;
+}
+
+/// Evaluate Waveform at a set of sky locations
+std::vector<std::vector<std::complex<double> > > GWFrames::Waveform::EvaluateAtPoints(const std::vector<double>& vartheta, const std::vector<double>& varphi,
+                                                                                      const unsigned int i_0, int i_1) const {
+  ///
+  /// \param vartheta Polar angles of detectors
+  /// \param varphi Azimuthal angles of detectors
+  /// \param i_0 Optional initial index to evaluate
+  /// \param i_1 Optional one-past-final index to evaluate
+  ///
+  /// The result has one row for each point, each of which is the
+  /// same as `EvaluateAtPoint` for that point.  But rather than
+  /// evaluating the SWSHs for every point at every time step, this
+  /// evaluates them once per point in the inertial frame (or the
+  /// constant frame), and rotates the modes into that frame once per
+  /// time step.  Evaluating all points is then just a matrix product
+  /// of the SWSH values with the mode data, which is done by
+  /// `ComplexMatrixProduct` (and hence by BLAS, if available).
+  ///
+  /// This requires all \f$m\f$ modes for each \f$\ell\f$ from
+  /// \f$|s|\f$ to the largest \f$\ell\f$ present, if the frame is
+  /// time dependent; otherwise, each point is evaluated separately.
+  ///
+
+  if(vartheta.size()!=varphi.size()) {
+    INFOTOCERR << "\nError: (vartheta.size()=" << vartheta.size() << ") != (varphi.size()=" << varphi.size() << ")" << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  if(frameType == GWFrames::UnknownFrameType) {
+    INFOTOCERR << "\nWarning: Asking for a Waveform in the " << GWFrames::WaveformFrameNames[GWFrames::UnknownFrameType] << " frame to be evaluated at points."
+               << "\n         This assumes that the Waveform::frame member data is correct...\n"
+               << std::endl;
+  }
+  if(i_1==-1) {
+    i_1 = NTimes();
+  }
+  if(i_0>=i_1) {
+    INFOTOCERR << "\nError: Asking to EvaluateAtPoints on indices (i_0=" << i_0 << ") >= (i_1=" << i_1 << ")."
+               << "\n       This is impossible; i_1 should be at least 1 more than i_0." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  if(i_1>NTimes()) {
+    INFOTOCERR << "\nError: Asking to EvaluateAtPoints on indices [i_0,i_1)=[" << i_0 << "," << i_1 << ") in a Waveform with " << NTimes() << " time steps." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+
+  const int NP = vartheta.size();
+  const int NM = NModes();
+  const int n_t = i_1-int(i_0);
+  vector<vector<complex<double> > > d(NP, vector<complex<double> >(n_t, complex<double>(0.,0.)));
+  if(NP==0) { return d; }
+
+  // With a time-dependent frame, we need to rotate the modes, which
+  // requires complete sets of m for each ell
+  bool CompleteModes = true;
+  if(frame.size()>1) {
+    const int s = std::abs(SpinWeight());
+    int NExpected = 0;
+    for(int ell=s; ell<=EllMax(); ++ell) { NExpected += 2*ell+1; }
+    for(int i_m=0; i_m<NM; ++i_m) {
+      if(LM(i_m)[0]<s || std::abs(LM(i_m)[1])>LM(i_m)[0]) { CompleteModes = false; }
+    }
+    CompleteModes = CompleteModes && (NExpected==NM);
+    if(!CompleteModes) {
+      for(int i_p=0; i_p<NP; ++i_p) {
+        d[i_p] = EvaluateAtPoint(vartheta[i_p], varphi[i_p], i_0, i_1);
+      }
+      return d;
+    }
+  }
+
+  // Evaluate the SWSHs for each point in the (constant or inertial) frame
+  vector<complex<double> > Ylm(NP*NM);
+  {
+    SphericalFunctions::SWSH Y(SpinWeight());
+    for(int i_p=0; i_p<NP; ++i_p) {
+      const Quaternions::Quaternion R_thetaphi(vartheta[i_p], varphi[i_p]);
+      if(frame.size()==1) {
+        Y.SetRotation(frame[0].inverse()*R_thetaphi);
+      } else {
+        Y.SetRotation(R_thetaphi);
+      }
       for(int i_m=0; i_m<NM; ++i_m) {
-        const int ell = LM(i_m)[0];
-        const int m   = LM(i_m)[1];
-        d[i_t-i_0] += Data(i_m, i_t) * Y(ell,m);
+        Ylm[i_p*NM+i_m] = Y(LM(i_m)[0], LM(i_m)[1]);
       }
     }
   }
 
+  // Work through chunks of time, rotating each to the inertial frame
+  // if necessary; the values at all points are then the product of
+  // the (NP x NModes) matrix of Ylms with the (NModes x n_chunk) data
+  const int TimeChunk = std::min(4096, n_t);
+  MatrixC Values(NP, TimeChunk);
+  for(int i_c=0; i_c<n_t; i_c+=TimeChunk) {
+    const int i_c_end = std::min(i_c+TimeChunk, n_t);
+    Waveform Chunk;
+    const MatrixC* Modes = &data;
+    int Offset = i_0+i_c;
+    if(frame.size()>1) {
+      Chunk.spinweight = spinweight;
+      Chunk.lm = lm;
+      Chunk.lmIndex = lmIndex;
+      Chunk.data.resize(NM, i_c_end-i_c);
+      for(int i_m=0; i_m<NM; ++i_m) {
+        std::copy(data[i_m]+i_0+i_c, data[i_m]+i_0+i_c_end, Chunk.data[i_m]);
+      }
+      Chunk.t.resize(i_c_end-i_c);
+      Chunk.TransformModesToRotatedFrame(Quaternions::conjugate(vector<Quaternion>(frame.begin()+i_0+i_c, frame.begin()+i_0+i_c_end)));
+      Modes = &Chunk.data;
+      Offset = 0;
+    }
+    ComplexMatrixProduct(NP, i_c_end-i_c, NM, Ylm.data(), NM, (*Modes)[0]+Offset, Modes->stride(), Values[0], Values.stride());
+    for(int i_p=0; i_p<NP; ++i_p) {
+      std::copy(Values[i_p], Values[i_p]+(i_c_end-i_c), d[i_p].begin()+i_c);
+    }
+  }
+
   return d;
 }
 
@@ -3352,6 +4901,7 @@ GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<d
   B.frame = std::vector<Quaternions::Quaternion>(0);
   B.frameType = GWFrames::Inertial;
   B.lm = A.lm;
+  B.lmIndex = A.lmIndex;
   B.t = A.t; // B.t will get reset later
 
   // These numbers determine the equi-angular grid on which we will do
@@ -3362,7 +4912,6 @@ GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<d
   const unsigned int N_theta = 2*ellMax + 1;
   const double dtheta = M_PI/double(N_theta-1); // theta should return to M_PI
   const double dphi = 2*M_PI/double(N_phi); // phi should not return to 2*M_PI
-  vector<complex<double> > Grid(N_phi*N_theta);
 
   // Find earliest and latest times we can use for our new data set
   unsigned int iEarliest = 0;
@@ -3406,54 +4955,69 @@ GWFrames::Waveform GWFrames::Waveform::Translate(const std::vector<std::vector<d
   B.t.erase(B.t.begin(), B.t.begin()+iEarliest);
   B.data.resize(NModes(), B.NTimes()); // Each row (first index, nn) corresponds to a mode
 
-  // We allocate just once, for speed, and pass these to InterpolateToPoint
-  gsl_interp_accel* accRe = gsl_interp_accel_alloc();
-  gsl_interp_accel* accIm = gsl_interp_accel_alloc();
-  gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, 4);
-  gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, 4);
-
-  // Main loop over time steps
-  for(unsigned int i_t_B=0; i_t_B<B.NTimes(); ++i_t_B) {
-    // These will hold the input and output data.  Note that spinsfast
-    // has had some weird behavior in the past when the output data is
-    // not initialized to zero, so just do this each time, even though
-    // it's slow.
-    vector<complex<double> > Modes(N_lm(ellMax), 0.0);
-
-    // Construct the data on the translated grid
-    for(int i_g=0, i_theta=0; i_theta<N_theta; ++i_theta) {
-      for(int i_phi=0; i_phi<N_phi; ++i_phi, ++i_g) {
-        const double theta = dtheta*i_theta;
-        const double phi = dphi*i_phi;
-
-        const double rHat_dot_deltax =
-          deltax[i_t_B][0]*std::sin(theta)*std::cos(phi)
-          + deltax[i_t_B][1]*std::sin(theta)*std::sin(phi)
-          + deltax[i_t_B][2]*std::cos(theta);
+  // Find where each of the modes output by spinsfast goes
+  vector<int> ModeIndices(N_lm(ellMax), -1);
+  for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    for(int m=-ell; m<=ell; ++m, ++i_mode) {
+      ModeIndices[i_mode] = B.FindModeIndex(ell,m);
+    }
+  }
 
-        // Evaluate the data for the translated frame at this point
-        Grid[i_g] = A.InterpolateToPoint(theta, phi, B.T(i_t_B)-rHat_dot_deltax, accRe, accIm, splineRe, splineIm);
+  // spinsfast makes FFTW plans in each thread
+  WaveformUtilities::MakeFFTWPlannerThreadSafe();
+  const int ntimesB = B.NTimes();
+  #pragma omp parallel if(ntimesB>1)
+  {
+    // We allocate just once (per thread), for speed, and pass these
+    // to InterpolateToPoint
+    gsl_interp_accel* accRe = gsl_interp_accel_alloc();
+    gsl_interp_accel* accIm = gsl_interp_accel_alloc();
+    gsl_spline* splineRe = gsl_spline_alloc(gsl_interp_cspline, 4);
+    gsl_spline* splineIm = gsl_spline_alloc(gsl_interp_cspline, 4);
+    vector<complex<double> > Grid(N_phi*N_theta);
+
+    // Main loop over time steps
+    #pragma omp for schedule(dynamic, 16)
+    for(int i_t_B=0; i_t_B<ntimesB; ++i_t_B) {
+      // These will hold the input and output data.  Note that spinsfast
+      // has had some weird behavior in the past when the output data is
+      // not initialized to zero, so just do this each time, even though
+      // it's slow.
+      vector<complex<double> > Modes(N_lm(ellMax), 0.0);
+
+      // Construct the data on the translated grid
+      for(int i_g=0, i_theta=0; i_theta<int(N_theta); ++i_theta) {
+        for(int i_phi=0; i_phi<int(N_phi); ++i_phi, ++i_g) {
+          const double theta = dtheta*i_theta;
+          const double phi = dphi*i_phi;
+
+          const double rHat_dot_deltax =
+            deltax[i_t_B][0]*std::sin(theta)*std::cos(phi)
+            + deltax[i_t_B][1]*std::sin(theta)*std::sin(phi)
+            + deltax[i_t_B][2]*std::cos(theta);
+
+          // Evaluate the data for the translated frame at this point
+          Grid[i_g] = A.InterpolateToPoint(theta, phi, B.T(i_t_B)-rHat_dot_deltax, accRe, accIm, splineRe, splineIm);
+        }
       }
-    }
 
-    // Decompose the data into modes
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
-                       reinterpret_cast<fftw_complex*>(&Modes[0]),
-                       SpinWeight(), N_theta, N_phi, ellMax);
+      // Decompose the data into modes
+      spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
+                         reinterpret_cast<fftw_complex*>(&Modes[0]),
+                         SpinWeight(), N_theta, N_phi, ellMax);
 
-    // Set new data at this time step
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        B.SetData(B.FindModeIndex(ell,m), i_t_B, Modes[i_mode]);
+      // Set new data at this time step
+      for(int i_mode=N_lm(std::abs(SpinWeight())-1); i_mode<N_lm(ellMax); ++i_mode) {
+        B.data[ModeIndices[i_mode]][i_t_B] = Modes[i_mode];
       }
-    }
 
-  } // i_t_B loop
+    } // i_t_B loop
 
-  gsl_interp_accel_free(accRe);
-  gsl_interp_accel_free(accIm);
-  gsl_spline_free(splineRe);
-  gsl_spline_free(splineIm);
+    gsl_interp_accel_free(accRe);
+    gsl_interp_accel_free(accIm);
+    gsl_spline_free(splineRe);
+    gsl_spline_free(splineIm);
+  }
 
   return B;
 }
@@ -3483,8 +5047,6 @@ GWFrames::Waveform& GWFrames::Waveform::BoostPsi4(const std::vector<std::vector<
   const int n_phiRotated = 2*ellMax+1;
   const double dthetaRotated = M_PI/double(n_thetaRotated-1); // thetaRotated should return to M_PI
   const double dphiRotated = 2*M_PI/double(n_phiRotated); // phiRotated should not return to 2*M_PI
-  vector<complex<double> > Grid(n_phiRotated*n_thetaRotated);
-  SphericalFunctions::SWSH sYlm(SpinWeight());
 
   SpacetimeAlgebra::vector tPz;
   tPz.set_gamma_0(1./std::sqrt(2));
@@ -3501,172 +5063,194 @@ GWFrames::Waveform& GWFrames::Waveform::BoostPsi4(const std::vector<std::vector<
   SpacetimeAlgebra::vector xMiyIm;
   xMiyIm.set_gamma_2(-1./std::sqrt(2));
 
-  // Main loop over time steps
+  // Check the sizes of the input velocities before going parallel
   for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    const vector<double>& v_i = v[i_t];
-    if(v_i.size()!=3) {
-      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v_i.size()
+    if(v[i_t].size()!=3) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v[i_t].size()
                 << ".  Input is assumed to be a vector of three-velocities." << std::endl;
       throw(GWFrames_VectorSizeMismatch);
     }
+  }
 
-    const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
-    if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
-    vector<double> vHat(3);
-    vHat[0] = v_i[0]/beta;
-    vHat[1] = v_i[1]/beta;
-    vHat[2] = v_i[2]/beta;
-    const double gamma = 1.0/std::sqrt(1.0-beta*beta);
-    const double sqrtplus = std::sqrt((gamma+1)/2);
-    const double sqrtminus = std::sqrt((gamma-1)/2);
-
-    // Calculate the boost rotor
-    SpacetimeAlgebra::spinor BoostRotor;
-    BoostRotor.set_scalar(sqrtplus);
-    BoostRotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
-    BoostRotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
-    BoostRotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
-
-    vector<complex<double> > Modes(N_lm(ellMax), 0.0);
-    vector<complex<double> > Modes2(N_lm(ellMax), 0.0);
-
-    // Fill the Modes data for this time step
-    for(int i_mode=0; i_mode<N_lm(std::abs(SpinWeight())-1); ++i_mode) {
-      // Explicitly zero the modes with ell<|s|
-      Modes[i_mode] = 0.0;
-    }
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      // Now, fill modes with ell>=|s| in the correct order
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        Modes[i_mode] = this->Data(FindModeIndex(ell,m), i_t);
-      }
-    }
-
-    // Construct the data on the distorted grid
-    for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
-      for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
-        const double thetaRotated = dthetaRotated*i_thetaRotated;
-        const double phiRotated = dphiRotated*i_phiRotated;
-
-        // Calculate the rotation rotors
-        SpacetimeAlgebra::spinor Rotor_thetaRotated;
-        Rotor_thetaRotated.set_scalar(std::cos(thetaRotated/2));
-        Rotor_thetaRotated.set_gamma_1_gamma_3(std::sin(thetaRotated/2));
-        SpacetimeAlgebra::spinor Rotor_phiRotated;
-        Rotor_phiRotated.set_scalar(std::cos(phiRotated/2));
-        Rotor_phiRotated.set_gamma_1_gamma_2(-std::sin(phiRotated/2));
-        const SpacetimeAlgebra::spinor RotationRotorRotated(Rotor_phiRotated * Rotor_thetaRotated);
-
-        // This is the complete transformation rotor for going from
-        // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
-        // boosted frame:
-        const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
-
-        // The following give the important tetrad elements in the boosted frame
-        const int Filler=0; // Useless constant for Gaigen code
-        const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-
-        // Figure out the coordinates in the present frame
-        // corresponding to the given coordinates in the boosted frame
-        vector<double> r(3);
-        r[0] = lRotated.get_gamma_1();
-        r[1] = lRotated.get_gamma_2();
-        r[2] = lRotated.get_gamma_3();
-        const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
-        const double theta = std::acos(r[2]/rMag);
-        const double phi = std::atan2(r[1],r[0]);
-
-        if(i_g==0 && i_t==0) {
-          std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":\n"
-                    << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
-                    << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
-                    << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
-                    << "    comes out as 0, even though phiRotated may not be.\n\n"
-                    << "    Fortunately, I think both these problems are handled automatically by taking the\n"
-                    << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
+  // Find the index of each (ell,m) mode in the spinsfast ordering
+  vector<int> ModeIndices(N_lm(ellMax), -1);
+  for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    for(int m=-ell; m<=ell; ++m, ++i_mode) {
+      ModeIndices[i_mode] = FindModeIndex(ell,m);
+    }
+  }
+
+  // spinsfast makes FFTW plans in each thread
+  WaveformUtilities::MakeFFTWPlannerThreadSafe();
+  const int ntimes = NTimes();
+  #pragma omp parallel if(ntimes>1)
+  {
+    vector<complex<double> > Grid(n_phiRotated*n_thetaRotated);
+    SphericalFunctions::SWSH sYlm(SpinWeight());
+
+    // Main loop over time steps
+    #pragma omp for schedule(dynamic, 4)
+    for(int i_t=0; i_t<ntimes; ++i_t) {
+      const vector<double>& v_i = v[i_t];
+
+      const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
+      if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
+      vector<double> vHat(3);
+      vHat[0] = v_i[0]/beta;
+      vHat[1] = v_i[1]/beta;
+      vHat[2] = v_i[2]/beta;
+      const double gamma = 1.0/std::sqrt(1.0-beta*beta);
+      const double sqrtplus = std::sqrt((gamma+1)/2);
+      const double sqrtminus = std::sqrt((gamma-1)/2);
+
+      // Calculate the boost rotor
+      SpacetimeAlgebra::spinor BoostRotor;
+      BoostRotor.set_scalar(sqrtplus);
+      BoostRotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
+      BoostRotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
+      BoostRotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
+
+      vector<complex<double> > Modes(N_lm(ellMax), 0.0);
+      vector<complex<double> > Modes2(N_lm(ellMax), 0.0);
+
+      // Fill the Modes data for this time step
+      for(int i_mode=0; i_mode<N_lm(std::abs(SpinWeight())-1); ++i_mode) {
+        // Explicitly zero the modes with ell<|s|
+        Modes[i_mode] = 0.0;
+      }
+      for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+        // Now, fill modes with ell>=|s| in the correct order
+        for(int m=-ell; m<=ell; ++m, ++i_mode) {
+          Modes[i_mode] = this->Data(ModeIndices[i_mode], i_t);
         }
+      }
+
+      // Construct the data on the distorted grid
+      for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
+        for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
+          const double thetaRotated = dthetaRotated*i_thetaRotated;
+          const double phiRotated = dphiRotated*i_phiRotated;
+
+          // Calculate the rotation rotors
+          SpacetimeAlgebra::spinor Rotor_thetaRotated;
+          Rotor_thetaRotated.set_scalar(std::cos(thetaRotated/2));
+          Rotor_thetaRotated.set_gamma_1_gamma_3(std::sin(thetaRotated/2));
+          SpacetimeAlgebra::spinor Rotor_phiRotated;
+          Rotor_phiRotated.set_scalar(std::cos(phiRotated/2));
+          Rotor_phiRotated.set_gamma_1_gamma_2(-std::sin(phiRotated/2));
+          const SpacetimeAlgebra::spinor RotationRotorRotated(Rotor_phiRotated * Rotor_thetaRotated);
+
+          // This is the complete transformation rotor for going from
+          // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
+          // boosted frame:
+          const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
+
+          // The following give the important tetrad elements in the boosted frame
+          const int Filler=0; // Useless constant for Gaigen code
+          const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+          const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+          const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+          const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+
+          // Figure out the coordinates in the present frame
+          // corresponding to the given coordinates in the boosted frame
+          vector<double> r(3);
+          r[0] = lRotated.get_gamma_1();
+          r[1] = lRotated.get_gamma_2();
+          r[2] = lRotated.get_gamma_3();
+          const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
+          const double theta = std::acos(r[2]/rMag);
+          const double phi = std::atan2(r[1],r[0]);
+
+          if(i_g==0 && i_t==0) {
+            std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":\n"
+                      << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
+                      << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
+                      << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
+                      << "    comes out as 0, even though phiRotated may not be.\n\n"
+                      << "    Fortunately, I think both these problems are handled automatically by taking the\n"
+                      << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
+          }
 
-        // This gives us the rotor to get from the z axis to the
-        // spherical coordinates in the present frame
-        SpacetimeAlgebra::spinor Rotor_theta;
-        Rotor_theta.set_scalar(std::cos(theta/2));
-        Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
-        SpacetimeAlgebra::spinor Rotor_phi;
-        Rotor_phi.set_scalar(std::cos(phi/2));
-        Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
-        const SpacetimeAlgebra::spinor RotationRotor(Rotor_phi * Rotor_theta);
-
-        // The following give the important tetrad elements in the present frame
-        const SpacetimeAlgebra::vector l(RotationRotor*tPz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector n(RotationRotor*tMz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mRe(RotationRotor*xPiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mIm(RotationRotor*xPiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarRe(RotationRotor*xMiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarIm(RotationRotor*xMiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-
-        // Get the value of Psi4 in this frame at the appropriate
-        // point of this frame
-        const Quaternion Rp(theta, phi);
-        sYlm.SetRotation(Rp);
-        const complex<double> Psi_4 = sYlm.Evaluate(Modes);
-
-        // Get the components of the other frame's tetrad in the basis
-        // of this tetrad.  In particular, these are *not* the dot
-        // products of the other frame's basis vectors with this
-        // frame's basis vectors.  Instead, we expand, e.g., nRotated
-        // in terms of this frame's (l,n,m,mbar) basis, and just take
-        // the coefficients in that expansion.  [This distinction
-        // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
-        // that we will not need any components involving the l vector
-        // in either frame, because that will just give us terms
-        // proportional to Psi3, etc., which are assumed to fall off
-        // more quickly than we care to bother with.
-        const complex<double> i_complex(0.,1.);
-        const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
-        const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
-        const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
-        const complex<double> mBarRotated_n =
-          - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
-        const complex<double> mBarRotated_m =
-          SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
-        const complex<double> mBarRotated_mBar =
-          SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
-
-        // Evaluate the data for the boosted frame at this point
-        Grid[i_g] =
-          (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
-           - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
-           - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
-           + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n) * Psi_4
-          + (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
-             - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
-             - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
-             + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n) * std::conj(Psi_4);
-
-        // if(i_t%5000==0) {
-        //   std::cerr << thetaRotated << "," << phiRotated << "; " << theta << "," << phi
-        //             << "; \t" << Grid[i_g] << "," << Psi_4 << std::endl;
-        // }
-      }
-    }
-
-    // Decompose the data into modes
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
-                       reinterpret_cast<fftw_complex*>(&Modes2[0]),
-                       SpinWeight(), n_thetaRotated, n_phiRotated, ellMax);
-
-    // Set new data at this time step
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        this->SetData(this->FindModeIndex(ell,m), i_t, Modes2[i_mode]);
+          // This gives us the rotor to get from the z axis to the
+          // spherical coordinates in the present frame
+          SpacetimeAlgebra::spinor Rotor_theta;
+          Rotor_theta.set_scalar(std::cos(theta/2));
+          Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
+          SpacetimeAlgebra::spinor Rotor_phi;
+          Rotor_phi.set_scalar(std::cos(phi/2));
+          Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
+          const SpacetimeAlgebra::spinor RotationRotor(Rotor_phi * Rotor_theta);
+
+          // The following give the important tetrad elements in the present frame
+          const SpacetimeAlgebra::vector l(RotationRotor*tPz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector n(RotationRotor*tMz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mRe(RotationRotor*xPiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mIm(RotationRotor*xPiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mBarRe(RotationRotor*xMiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mBarIm(RotationRotor*xMiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+
+          // Get the value of Psi4 in this frame at the appropriate
+          // point of this frame
+          const Quaternion Rp(theta, phi);
+          sYlm.SetRotation(Rp);
+          const complex<double> Psi_4 = sYlm.Evaluate(Modes);
+
+          // Get the components of the other frame's tetrad in the basis
+          // of this tetrad.  In particular, these are *not* the dot
+          // products of the other frame's basis vectors with this
+          // frame's basis vectors.  Instead, we expand, e.g., nRotated
+          // in terms of this frame's (l,n,m,mbar) basis, and just take
+          // the coefficients in that expansion.  [This distinction
+          // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
+          // that we will not need any components involving the l vector
+          // in either frame, because that will just give us terms
+          // proportional to Psi3, etc., which are assumed to fall off
+          // more quickly than we care to bother with.
+          const complex<double> i_complex(0.,1.);
+          const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
+          const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
+          const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
+          const complex<double> mBarRotated_n =
+            - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
+          const complex<double> mBarRotated_m =
+            SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
+            + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
+          const complex<double> mBarRotated_mBar =
+            SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
+            + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
+
+          // Evaluate the data for the boosted frame at this point
+          Grid[i_g] =
+            (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
+             - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
+             - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
+             + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n) * Psi_4
+            + (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
+               - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
+               - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
+               + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n) * std::conj(Psi_4);
+
+          // if(i_t%5000==0) {
+          //   std::cerr << thetaRotated << "," << phiRotated << "; " << theta << "," << phi
+          //             << "; \t" << Grid[i_g] << "," << Psi_4 << std::endl;
+          // }
+        }
       }
-    }
 
+      // Decompose the data into modes
+      spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
+                         reinterpret_cast<fftw_complex*>(&Modes2[0]),
+                         SpinWeight(), n_thetaRotated, n_phiRotated, ellMax);
+
+      // Set new data at this time step
+      for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+        for(int m=-ell; m<=ell; ++m, ++i_mode) {
+          this->SetData(ModeIndices[i_mode], i_t, Modes2[i_mode]);
+        }
+      }
+
+    }
   }
 
   return *this;
@@ -3708,8 +5292,6 @@ GWFrames::Waveform& GWFrames::Waveform::BoostHFaked(const std::vector<std::vecto
   const int n_phiRotated = 2*ellMax+1;
   const double dthetaRotated = M_PI/double(n_thetaRotated-1); // thetaRotated should return to M_PI
   const double dphiRotated = 2*M_PI/double(n_phiRotated); // phiRotated should not return to 2*M_PI
-  vector<complex<double> > Grid(n_phiRotated*n_thetaRotated);
-  SphericalFunctions::SWSH sYlm(SpinWeight());
 
   SpacetimeAlgebra::vector tPz;
   tPz.set_gamma_0(1./std::sqrt(2));
@@ -3726,172 +5308,194 @@ GWFrames::Waveform& GWFrames::Waveform::BoostHFaked(const std::vector<std::vecto
   SpacetimeAlgebra::vector xMiyIm;
   xMiyIm.set_gamma_2(-1./std::sqrt(2));
 
-  // Main loop over time steps
+  // Check the sizes of the input velocities before going parallel
   for(unsigned int i_t=0; i_t<NTimes(); ++i_t) {
-    const vector<double>& v_i = v[i_t];
-    if(v_i.size()!=3) {
-      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v_i.size()
+    if(v[i_t].size()!=3) {
+      std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": v[" << i_t << "].size()=" << v[i_t].size()
                 << ".  Input is assumed to be a vector of three-velocities." << std::endl;
       throw(GWFrames_VectorSizeMismatch);
     }
+  }
 
-    const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
-    if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
-    vector<double> vHat(3);
-    vHat[0] = v_i[0]/beta;
-    vHat[1] = v_i[1]/beta;
-    vHat[2] = v_i[2]/beta;
-    const double gamma = 1.0/std::sqrt(1.0-beta*beta);
-    const double sqrtplus = std::sqrt((gamma+1)/2);
-    const double sqrtminus = std::sqrt((gamma-1)/2);
-
-    // Calculate the boost rotor
-    SpacetimeAlgebra::spinor BoostRotor;
-    BoostRotor.set_scalar(sqrtplus);
-    BoostRotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
-    BoostRotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
-    BoostRotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
-
-    vector<complex<double> > Modes(N_lm(ellMax), 0.0);
-    vector<complex<double> > Modes2(N_lm(ellMax), 0.0);
-
-    // Fill the Modes data for this time step
-    for(int i_mode=0; i_mode<N_lm(std::abs(SpinWeight())-1); ++i_mode) {
-      // Explicitly zero the modes with ell<|s|
-      Modes[i_mode] = 0.0;
-    }
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      // Now, fill modes with ell>=|s| in the correct order
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        Modes[i_mode] = this->Data(FindModeIndex(ell,m), i_t);
-      }
-    }
-
-    // Construct the data on the distorted grid
-    for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
-      for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
-        const double thetaRotated = dthetaRotated*i_thetaRotated;
-        const double phiRotated = dphiRotated*i_phiRotated;
-
-        // Calculate the rotation rotors
-        SpacetimeAlgebra::spinor Rotor_thetaRotated;
-        Rotor_thetaRotated.set_scalar(std::cos(thetaRotated/2));
-        Rotor_thetaRotated.set_gamma_1_gamma_3(std::sin(thetaRotated/2));
-        SpacetimeAlgebra::spinor Rotor_phiRotated;
-        Rotor_phiRotated.set_scalar(std::cos(phiRotated/2));
-        Rotor_phiRotated.set_gamma_1_gamma_2(-std::sin(phiRotated/2));
-        const SpacetimeAlgebra::spinor RotationRotorRotated(Rotor_phiRotated * Rotor_thetaRotated);
-
-        // This is the complete transformation rotor for going from
-        // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
-        // boosted frame:
-        const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
-
-        // The following give the important tetrad elements in the boosted frame
-        const int Filler=0; // Useless constant for Gaigen code
-        const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-        const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
-
-        // Figure out the coordinates in the present frame
-        // corresponding to the given coordinates in the boosted frame
-        vector<double> r(3);
-        r[0] = lRotated.get_gamma_1();
-        r[1] = lRotated.get_gamma_2();
-        r[2] = lRotated.get_gamma_3();
-        const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
-        const double theta = std::acos(r[2]/rMag);
-        const double phi = std::atan2(r[1],r[0]);
-
-        if(i_g==0 && i_t==0) {
-          std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":\n"
-                    << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
-                    << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
-                    << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
-                    << "    comes out as 0, even though phiRotated may not be.\n\n"
-                    << "    Fortunately, I think both these problems are handled automatically by taking the\n"
-                    << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
+  // Find the index of each (ell,m) mode in the spinsfast ordering
+  vector<int> ModeIndices(N_lm(ellMax), -1);
+  for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+    for(int m=-ell; m<=ell; ++m, ++i_mode) {
+      ModeIndices[i_mode] = FindModeIndex(ell,m);
+    }
+  }
+
+  // spinsfast makes FFTW plans in each thread
+  WaveformUtilities::MakeFFTWPlannerThreadSafe();
+  const int ntimes = NTimes();
+  #pragma omp parallel if(ntimes>1)
+  {
+    vector<complex<double> > Grid(n_phiRotated*n_thetaRotated);
+    SphericalFunctions::SWSH sYlm(SpinWeight());
+
+    // Main loop over time steps
+    #pragma omp for schedule(dynamic, 4)
+    for(int i_t=0; i_t<ntimes; ++i_t) {
+      const vector<double>& v_i = v[i_t];
+
+      const double beta = std::sqrt(v_i[0]*v_i[0] + v_i[1]*v_i[1] + v_i[2]*v_i[2]);
+      if(beta<1.e-9) { continue; } // TODO: This may need to be adjusted, or other statements made smarter about using the value of gamma
+      vector<double> vHat(3);
+      vHat[0] = v_i[0]/beta;
+      vHat[1] = v_i[1]/beta;
+      vHat[2] = v_i[2]/beta;
+      const double gamma = 1.0/std::sqrt(1.0-beta*beta);
+      const double sqrtplus = std::sqrt((gamma+1)/2);
+      const double sqrtminus = std::sqrt((gamma-1)/2);
+
+      // Calculate the boost rotor
+      SpacetimeAlgebra::spinor BoostRotor;
+      BoostRotor.set_scalar(sqrtplus);
+      BoostRotor.set_gamma_0_gamma_1(sqrtminus*vHat[0]);
+      BoostRotor.set_gamma_0_gamma_2(sqrtminus*vHat[1]);
+      BoostRotor.set_gamma_0_gamma_3(sqrtminus*vHat[2]);
+
+      vector<complex<double> > Modes(N_lm(ellMax), 0.0);
+      vector<complex<double> > Modes2(N_lm(ellMax), 0.0);
+
+      // Fill the Modes data for this time step
+      for(int i_mode=0; i_mode<N_lm(std::abs(SpinWeight())-1); ++i_mode) {
+        // Explicitly zero the modes with ell<|s|
+        Modes[i_mode] = 0.0;
+      }
+      for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+        // Now, fill modes with ell>=|s| in the correct order
+        for(int m=-ell; m<=ell; ++m, ++i_mode) {
+          Modes[i_mode] = this->Data(ModeIndices[i_mode], i_t);
         }
+      }
 
-        // This gives us the rotor to get from the z axis to the
-        // spherical coordinates in the present frame
-        SpacetimeAlgebra::spinor Rotor_theta;
-        Rotor_theta.set_scalar(std::cos(theta/2));
-        Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
-        SpacetimeAlgebra::spinor Rotor_phi;
-        Rotor_phi.set_scalar(std::cos(phi/2));
-        Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
-        const SpacetimeAlgebra::spinor RotationRotor(Rotor_phi * Rotor_theta);
-
-        // The following give the important tetrad elements in the present frame
-        const SpacetimeAlgebra::vector l(RotationRotor*tPz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector n(RotationRotor*tMz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mRe(RotationRotor*xPiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mIm(RotationRotor*xPiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarRe(RotationRotor*xMiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-        const SpacetimeAlgebra::vector mBarIm(RotationRotor*xMiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
-
-        // Get the value of h in this frame at the appropriate point
-        // of this frame
-        const Quaternion Rp(theta, phi);
-        sYlm.SetRotation(Rp);
-        const complex<double> h = sYlm.Evaluate(Modes);
-
-        // Get the components of the other frame's tetrad in the basis
-        // of this tetrad.  In particular, these are *not* the dot
-        // products of the other frame's basis vectors with this
-        // frame's basis vectors.  Instead, we expand, e.g., nRotated
-        // in terms of this frame's (l,n,m,mbar) basis, and just take
-        // the coefficients in that expansion.  [This distinction
-        // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
-        // that we will not need any components involving the l vector
-        // in either frame, because that will just give us terms
-        // proportional to Psi3, etc., which are assumed to fall off
-        // more quickly than we care to bother with.
-        const complex<double> i_complex(0.,1.);
-        const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
-        const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
-        const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
-        const complex<double> mBarRotated_n =
-          - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
-        const complex<double> mBarRotated_m =
-          SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
-        const complex<double> mBarRotated_mBar =
-          SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
-          + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
-
-        // Evaluate the data for the boosted frame at this point
-        Grid[i_g] =
-          ( (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
-             - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
-             - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
-             + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n) * h
-            + (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
-               - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
-               - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
-               + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n) * std::conj(h) ) / (gamma*gamma);
+      // Construct the data on the distorted grid
+      for(int i_g=0, i_thetaRotated=0; i_thetaRotated<n_thetaRotated; ++i_thetaRotated) {
+        for(int i_phiRotated=0; i_phiRotated<n_phiRotated; ++i_phiRotated, ++i_g) {
+          const double thetaRotated = dthetaRotated*i_thetaRotated;
+          const double phiRotated = dphiRotated*i_phiRotated;
+
+          // Calculate the rotation rotors
+          SpacetimeAlgebra::spinor Rotor_thetaRotated;
+          Rotor_thetaRotated.set_scalar(std::cos(thetaRotated/2));
+          Rotor_thetaRotated.set_gamma_1_gamma_3(std::sin(thetaRotated/2));
+          SpacetimeAlgebra::spinor Rotor_phiRotated;
+          Rotor_phiRotated.set_scalar(std::cos(phiRotated/2));
+          Rotor_phiRotated.set_gamma_1_gamma_2(-std::sin(phiRotated/2));
+          const SpacetimeAlgebra::spinor RotationRotorRotated(Rotor_phiRotated * Rotor_thetaRotated);
+
+          // This is the complete transformation rotor for going from
+          // (t,x,y,z) in the present frame to (t,theta,phi,r) in the
+          // boosted frame:
+          const SpacetimeAlgebra::spinor LorentzRotor(BoostRotor * RotationRotorRotated);
+
+          // The following give the important tetrad elements in the boosted frame
+          const int Filler=0; // Useless constant for Gaigen code
+          const SpacetimeAlgebra::vector lRotated(LorentzRotor*tPz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+          const SpacetimeAlgebra::vector nRotated(LorentzRotor*tMz*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+          const SpacetimeAlgebra::vector mBarReRotated(LorentzRotor*xMiyRe*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+          const SpacetimeAlgebra::vector mBarImRotated(LorentzRotor*xMiyIm*SpacetimeAlgebra::reverse(LorentzRotor), Filler);
+
+          // Figure out the coordinates in the present frame
+          // corresponding to the given coordinates in the boosted frame
+          vector<double> r(3);
+          r[0] = lRotated.get_gamma_1();
+          r[1] = lRotated.get_gamma_2();
+          r[2] = lRotated.get_gamma_3();
+          const double rMag = std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
+          const double theta = std::acos(r[2]/rMag);
+          const double phi = std::atan2(r[1],r[0]);
+
+          if(i_g==0 && i_t==0) {
+            std::cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ":\n"
+                      << "    Note that the (theta,phi) coordinates produced here are not in the same range\n"
+                      << "    as the (thetaRotated,phiRotated) coordinates because of (1) the range of atan2,\n"
+                      << "    which is in (-pi,pi), rather than (0,2*pi); and (2) at (theta=0), the phi value\n"
+                      << "    comes out as 0, even though phiRotated may not be.\n\n"
+                      << "    Fortunately, I think both these problems are handled automatically by taking the\n"
+                      << "    tetrad components as we do.  Of course, I may be missing something problematic...\n" << std::endl;
+          }
 
-        // if(i_t%5000==0) {
-        //   std::cerr << thetaRotated << "," << phiRotated << "; " << theta << "," << phi
-        //             << "; \t" << Grid[i_g] << "," << h << std::endl;
-        // }
+          // This gives us the rotor to get from the z axis to the
+          // spherical coordinates in the present frame
+          SpacetimeAlgebra::spinor Rotor_theta;
+          Rotor_theta.set_scalar(std::cos(theta/2));
+          Rotor_theta.set_gamma_1_gamma_3(std::sin(theta/2));
+          SpacetimeAlgebra::spinor Rotor_phi;
+          Rotor_phi.set_scalar(std::cos(phi/2));
+          Rotor_phi.set_gamma_1_gamma_2(-std::sin(phi/2));
+          const SpacetimeAlgebra::spinor RotationRotor(Rotor_phi * Rotor_theta);
+
+          // The following give the important tetrad elements in the present frame
+          const SpacetimeAlgebra::vector l(RotationRotor*tPz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector n(RotationRotor*tMz*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mRe(RotationRotor*xPiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mIm(RotationRotor*xPiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mBarRe(RotationRotor*xMiyRe*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+          const SpacetimeAlgebra::vector mBarIm(RotationRotor*xMiyIm*SpacetimeAlgebra::reverse(RotationRotor), Filler);
+
+          // Get the value of h in this frame at the appropriate point
+          // of this frame
+          const Quaternion Rp(theta, phi);
+          sYlm.SetRotation(Rp);
+          const complex<double> h = sYlm.Evaluate(Modes);
+
+          // Get the components of the other frame's tetrad in the basis
+          // of this tetrad.  In particular, these are *not* the dot
+          // products of the other frame's basis vectors with this
+          // frame's basis vectors.  Instead, we expand, e.g., nRotated
+          // in terms of this frame's (l,n,m,mbar) basis, and just take
+          // the coefficients in that expansion.  [This distinction
+          // matters because, e.g., n.n = 0 but n.l \neq 0.]  Also note
+          // that we will not need any components involving the l vector
+          // in either frame, because that will just give us terms
+          // proportional to Psi3, etc., which are assumed to fall off
+          // more quickly than we care to bother with.
+          const complex<double> i_complex(0.,1.);
+          const complex<double> nRotated_n = -SpacetimeAlgebra::sp(nRotated, l);
+          const complex<double> nRotated_m = SpacetimeAlgebra::sp(nRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mBarIm);
+          const complex<double> nRotated_mBar = SpacetimeAlgebra::sp(nRotated, mRe) + i_complex*SpacetimeAlgebra::sp(nRotated, mIm);
+          const complex<double> mBarRotated_n =
+            - ( SpacetimeAlgebra::sp(mBarReRotated, l) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, l) );
+          const complex<double> mBarRotated_m =
+            SpacetimeAlgebra::sp(mBarReRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mBarIm)
+            + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mBarRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mBarIm) );
+          const complex<double> mBarRotated_mBar =
+            SpacetimeAlgebra::sp(mBarReRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarReRotated, mIm)
+            + i_complex * ( SpacetimeAlgebra::sp(mBarImRotated, mRe) + i_complex*SpacetimeAlgebra::sp(mBarImRotated, mIm) );
+
+          // Evaluate the data for the boosted frame at this point
+          Grid[i_g] =
+            ( (nRotated_n * mBarRotated_mBar * nRotated_n * mBarRotated_mBar
+               - nRotated_mBar * mBarRotated_n * nRotated_n * mBarRotated_mBar
+               - nRotated_n * mBarRotated_mBar * nRotated_mBar * mBarRotated_n
+               + nRotated_mBar * mBarRotated_n * nRotated_mBar * mBarRotated_n) * h
+              + (nRotated_n * mBarRotated_m * nRotated_n * mBarRotated_m
+                 - nRotated_m * mBarRotated_n * nRotated_n * mBarRotated_m
+                 - nRotated_n * mBarRotated_m * nRotated_m * mBarRotated_n
+                 + nRotated_m * mBarRotated_n * nRotated_m * mBarRotated_n) * std::conj(h) ) / (gamma*gamma);
+
+          // if(i_t%5000==0) {
+          //   std::cerr << thetaRotated << "," << phiRotated << "; " << theta << "," << phi
+          //             << "; \t" << Grid[i_g] << "," << h << std::endl;
+          // }
+        }
       }
-    }
 
-    // Decompose the data into modes
-    spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
-                       reinterpret_cast<fftw_complex*>(&Modes2[0]),
-                       SpinWeight(), n_thetaRotated, n_phiRotated, ellMax);
+      // Decompose the data into modes
+      spinsfast_map2salm(reinterpret_cast<fftw_complex*>(&Grid[0]),
+                         reinterpret_cast<fftw_complex*>(&Modes2[0]),
+                         SpinWeight(), n_thetaRotated, n_phiRotated, ellMax);
 
-    // Set new data at this time step
-    for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
-      for(int m=-ell; m<=ell; ++m, ++i_mode) {
-        this->SetData(this->FindModeIndex(ell,m), i_t, Modes2[i_mode]);
+      // Set new data at this time step
+      for(int i_mode=N_lm(std::abs(SpinWeight())-1), ell=std::abs(SpinWeight()); ell<=ellMax; ++ell) {
+        for(int m=-ell; m<=ell; ++m, ++i_mode) {
+          this->SetData(ModeIndices[i_mode], i_t, Modes2[i_mode]);
+        }
       }
-    }
 
+    }
   }
 
   return *this;
@@ -3921,7 +5525,502 @@ const GWFrames::Waveform& GWFrames::Waveform::Output(const std::string& FileName
   return *this;
 }
 
-GWFrames::Waveform GWFrames::Waveform::operator+(const GWFrames::Waveform& B) const {
+#ifndef DOXYGEN
+// Fixed-size header at the start of the native binary format.  Each
+// block after the header starts at an offset that is a multiple of
+// BinaryWaveformAlignment, so that the time and data blocks can be
+// used in place from a memory-mapped file.
+//
+//   header | lm (int32 pairs) | history (chars) | t (doubles)
+//          | frame (4 doubles each) | data (complex<double>, mode-major)
+namespace {
+  const char BinaryWaveformMagic[8] = { 'G', 'W', 'F', 'r', 'B', 'i', 'n', '\0' };
+  const uint32_t BinaryWaveformVersion = 1;
+  const uint32_t BinaryWaveformByteOrderMark = 0x01020304;
+  const uint64_t BinaryWaveformAlignment = 64;
+
+  struct BinaryWaveformHeader {
+    char Magic[8];
+    uint32_t Version;
+    uint32_t ByteOrderMark;
+    int32_t SpinWeight;
+    int32_t BoostWeight;
+    int32_t FrameType;
+    int32_t DataType;
+    int32_t RIsScaledOut;
+    int32_t MIsScaledOut;
+    uint64_t NModes;
+    uint64_t NTimes;
+    uint64_t NFrame;
+    uint64_t HistoryLength;
+    uint64_t LMOffset;
+    uint64_t HistoryOffset;
+    uint64_t TimeOffset;
+    uint64_t FrameOffset;
+    uint64_t DataOffset;
+    uint64_t FileSize;
+  };
+
+  inline uint64_t BinaryWaveformAlign(const uint64_t Offset) {
+    return ((Offset+BinaryWaveformAlignment-1)/BinaryWaveformAlignment)*BinaryWaveformAlignment;
+  }
+
+  // True if Count elements of ElementSize bytes, starting at Offset,
+  // fit before End; written so that nothing can overflow
+  inline bool BinaryWaveformBlockFits(const uint64_t Offset, const uint64_t Count, const uint64_t ElementSize, const uint64_t End) {
+    return Offset<=End && Count<=(End-Offset)/ElementSize;
+  }
+
+  struct BinaryWaveformUnmapper {
+    uint64_t Size;
+    BinaryWaveformUnmapper(const uint64_t size) : Size(size) { }
+    void operator()(void* Map) const { munmap(Map, Size); }
+  };
+
+  void BinaryWaveformPad(std::ofstream& ofs, const uint64_t Offset) {
+    static const char Zeros[BinaryWaveformAlignment] = { 0 };
+    const uint64_t Position = ofs.tellp();
+    if(Position<Offset) { ofs.write(Zeros, Offset-Position); }
+  }
+
+  // Write everything up to the data block, leaving ofs at the start
+  // of the data block.  The number of modes is taken from W.LM(), so
+  // that W need not actually hold any data.
+  BinaryWaveformHeader WriteBinaryWaveformMetadata(std::ofstream& ofs, const GWFrames::Waveform& W, const std::string& History) {
+    const std::vector<std::vector<int> >& lm = W.LM();
+    const std::vector<double>& t = W.T();
+    const std::vector<Quaternions::Quaternion>& frame = W.Frame();
+
+    BinaryWaveformHeader Header;
+    std::memset(&Header, 0, sizeof(Header));
+    std::memcpy(Header.Magic, BinaryWaveformMagic, sizeof(Header.Magic));
+    Header.Version = BinaryWaveformVersion;
+    Header.ByteOrderMark = BinaryWaveformByteOrderMark;
+    Header.SpinWeight = W.SpinWeight();
+    Header.BoostWeight = W.BoostWeight();
+    Header.FrameType = W.FrameType();
+    Header.DataType = W.DataType();
+    Header.RIsScaledOut = W.RIsScaledOut();
+    Header.MIsScaledOut = W.MIsScaledOut();
+    Header.NModes = lm.size();
+    Header.NTimes = t.size();
+    Header.NFrame = frame.size();
+    Header.HistoryLength = History.size();
+    Header.LMOffset = BinaryWaveformAlign(sizeof(Header));
+    Header.HistoryOffset = BinaryWaveformAlign(Header.LMOffset + 2*sizeof(int32_t)*Header.NModes);
+    Header.TimeOffset = BinaryWaveformAlign(Header.HistoryOffset + Header.HistoryLength);
+    Header.FrameOffset = BinaryWaveformAlign(Header.TimeOffset + sizeof(double)*Header.NTimes);
+    Header.DataOffset = BinaryWaveformAlign(Header.FrameOffset + 4*sizeof(double)*Header.NFrame);
+    Header.FileSize = Header.DataOffset + sizeof(complex<double>)*Header.NModes*Header.NTimes;
+
+    ofs.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+    BinaryWaveformPad(ofs, Header.LMOffset);
+    for(unsigned int i_m=0; i_m<lm.size(); ++i_m) {
+      const int32_t LM[2] = { lm[i_m][0], lm[i_m][1] };
+      ofs.write(reinterpret_cast<const char*>(LM), sizeof(LM));
+    }
+    BinaryWaveformPad(ofs, Header.HistoryOffset);
+    ofs.write(History.c_str(), History.size());
+    BinaryWaveformPad(ofs, Header.TimeOffset);
+    if(t.size()>0) {
+      ofs.write(reinterpret_cast<const char*>(&t[0]), sizeof(double)*t.size());
+    }
+    BinaryWaveformPad(ofs, Header.FrameOffset);
+    for(unsigned int i_f=0; i_f<frame.size(); ++i_f) {
+      const double R[4] = { frame[i_f][0], frame[i_f][1], frame[i_f][2], frame[i_f][3] };
+      ofs.write(reinterpret_cast<const char*>(R), sizeof(R));
+    }
+    BinaryWaveformPad(ofs, Header.DataOffset);
+    return Header;
+  }
+
+  // A binary Waveform file whose data block is mapped into memory
+  // for writing, so that it can be filled in one piece at a time
+  // without ever holding all of the data in memory.  Pages are
+  // written back to the file by the kernel as needed, and finally
+  // when the object is destroyed.
+  class BinaryWaveformFileWriter {
+  private:
+    uint64_t Size;
+    uint64_t NTimes;
+    void* Map;
+    complex<double>* Data;
+    BinaryWaveformFileWriter(const BinaryWaveformFileWriter&);
+    BinaryWaveformFileWriter& operator=(const BinaryWaveformFileWriter&);
+  public:
+    BinaryWaveformFileWriter(const std::string& FileName, const GWFrames::Waveform& Metadata, const std::string& History)
+      : Size(0), NTimes(Metadata.NTimes()), Map(0), Data(0)
+    {
+      BinaryWaveformHeader Header;
+      {
+        ofstream ofs(FileName.c_str(), ofstream::out | ofstream::binary | ofstream::trunc);
+        if(!ofs.is_open()) {
+          cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "' for writing" << endl;
+          throw(GWFrames_BadFileName);
+        }
+        Header = WriteBinaryWaveformMetadata(ofs, Metadata, History);
+        if(!ofs) {
+          cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed writing to '" << FileName << "'" << endl;
+          throw(GWFrames_FailedSystemCall);
+        }
+      }
+      Size = Header.FileSize;
+      const int fd = open(FileName.c_str(), O_RDWR);
+      if(fd<0 || ftruncate(fd, Size)!=0) {
+        if(fd>=0) { close(fd); }
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't resize '" << FileName << "' to " << Size << " bytes" << endl;
+        throw(GWFrames_FailedSystemCall);
+      }
+      Map = mmap(0, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close(fd);
+      if(Map==MAP_FAILED) {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't mmap '" << FileName << "'" << endl;
+        throw(GWFrames_FailedSystemCall);
+      }
+      Data = reinterpret_cast<complex<double>*>(static_cast<char*>(Map)+Header.DataOffset);
+    }
+    ~BinaryWaveformFileWriter() { munmap(Map, Size); }
+    // Pointer to the data for mode i_m, starting at time index i_t
+    inline complex<double>* operator()(const unsigned int i_m, const unsigned int i_t) { return Data+i_m*NTimes+i_t; }
+  };
+}
+#endif // DOXYGEN
+
+/// Output Waveform object to a native binary file
+const GWFrames::Waveform& GWFrames::Waveform::OutputBinary(const std::string& FileName) const {
+  ///
+  /// \param FileName Relative path to data file
+  ///
+  /// The file can be read back with the constructor
+  /// `Waveform(FileName, "Binary")`.  Unlike `Output`, this format
+  /// stores all of the Waveform's metadata, and the data are stored
+  /// exactly (as raw doubles in native byte order), so that reading
+  /// is just a matter of mapping the file into memory.  The file
+  /// layout is
+  ///
+  ///   header | lm | history | t | frame | data
+  ///
+  /// where each block starts on a 64-byte boundary, and the data
+  /// block stores each mode contiguously, in the order of `LM()`.
+  const std::string History = history.str() + "this->OutputBinary(" + FileName + ")\n";
+
+  ofstream ofs(FileName.c_str(), ofstream::out | ofstream::binary);
+  if(!ofs.is_open()) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "' for writing" << endl;
+    throw(GWFrames_BadFileName);
+  }
+  WriteBinaryWaveformMetadata(ofs, *this, History);
+  for(unsigned int i_m=0; i_m<NModes(); ++i_m) {
+    ofs.write(reinterpret_cast<const char*>(data[i_m]), sizeof(complex<double>)*NTimes());
+  }
+  if(!ofs) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Failed writing to '" << FileName << "'" << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
+  ofs.close();
+  return *this;
+}
+
+/// Read a file written by `OutputBinary` into this object
+void GWFrames::Waveform::ReadBinary(const std::string& FileName) {
+  ///
+  /// \param FileName Relative path to data file
+  ///
+  /// The file is mapped into memory, rather than parsed, and the mode
+  /// data are used directly from the mapping, so the cost of reading
+  /// is essentially that of copying the times and frame.  The history
+  /// stored in the file replaces the history of this object, and is
+  /// followed by a note about the constructor.
+  const int fd = open(FileName.c_str(), O_RDONLY);
+  if(fd<0) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't open '" << FileName << "'" << endl;
+    throw(GWFrames_BadFileName);
+  }
+  struct stat FileStat;
+  if(fstat(fd, &FileStat)!=0) {
+    close(fd);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't stat '" << FileName << "'" << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
+  const uint64_t FileSize = FileStat.st_size;
+  if(FileSize<sizeof(BinaryWaveformHeader)) {
+    close(fd);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' is too small to be a binary Waveform file" << endl;
+    throw(GWFrames_BadFileName);
+  }
+  // The mapping is private, so the (copy-on-write) data can be
+  // modified in memory without altering the file
+  void* Map = mmap(0, FileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(Map==MAP_FAILED) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Couldn't mmap '" << FileName << "'" << endl;
+    throw(GWFrames_FailedSystemCall);
+  }
+  const char* Bytes = static_cast<const char*>(Map);
+
+  BinaryWaveformHeader Header;
+  std::memcpy(&Header, Bytes, sizeof(Header));
+  if(std::memcmp(Header.Magic, BinaryWaveformMagic, sizeof(Header.Magic))!=0
+     || Header.ByteOrderMark!=BinaryWaveformByteOrderMark
+     || Header.Version!=BinaryWaveformVersion) {
+    munmap(Map, FileSize);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' is not a binary Waveform file"
+         << " (or was written with a different version or byte order)" << endl;
+    throw(GWFrames_BadFileName);
+  }
+  // Each block must fit before the next one starts, and the data
+  // block before the end of the file, so every block lies inside the
+  // mapping.  The size of the data block is checked one factor at a
+  // time (NModes is already bounded by the size of the LM block), so
+  // that corrupt counts can't overflow the product.  The blocks are
+  // read through typed pointers, so their offsets must also be
+  // suitably aligned (mmap itself returns a page-aligned address).
+  if(Header.LMOffset%alignof(int32_t)!=0 || Header.TimeOffset%alignof(double)!=0
+     || Header.FrameOffset%alignof(double)!=0 || Header.DataOffset%alignof(complex<double>)!=0) {
+    munmap(Map, FileSize);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' has misaligned block offsets;"
+         << " it may be corrupt." << endl;
+    throw(GWFrames_BadFileName);
+  }
+  if(Header.FileSize!=FileSize
+     || Header.LMOffset<sizeof(BinaryWaveformHeader)
+     || !BinaryWaveformBlockFits(Header.LMOffset, Header.NModes, 2*sizeof(int32_t), Header.HistoryOffset)
+     || !BinaryWaveformBlockFits(Header.HistoryOffset, Header.HistoryLength, 1, Header.TimeOffset)
+     || !BinaryWaveformBlockFits(Header.TimeOffset, Header.NTimes, sizeof(double), Header.FrameOffset)
+     || !BinaryWaveformBlockFits(Header.FrameOffset, Header.NFrame, 4*sizeof(double), Header.DataOffset)
+     || Header.DataOffset>FileSize
+     || (Header.NModes>0 && !BinaryWaveformBlockFits(0, Header.NTimes, sizeof(complex<double>)*Header.NModes, FileSize-Header.DataOffset))
+     || Header.FrameType<0 || Header.FrameType>=5 || Header.DataType<0 || Header.DataType>=8) {
+    munmap(Map, FileSize);
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": '" << FileName << "' has an inconsistent header;"
+         << " it may be truncated." << endl;
+    throw(GWFrames_BadFileName);
+  }
+
+  spinweight = Header.SpinWeight;
+  boostweight = Header.BoostWeight;
+  frameType = WaveformFrameType(Header.FrameType);
+  dataType = WaveformDataType(Header.DataType);
+  rIsScaledOut = Header.RIsScaledOut;
+  mIsScaledOut = Header.MIsScaledOut;
+
+  history.str(string(Bytes+Header.HistoryOffset, Header.HistoryLength));
+  history.clear();
+  history.seekp(0, ios_base::end);
+  history << "Waveform(" << FileName << ", Binary); // Constructor from data file" << endl;
+
+  const int32_t* LM = reinterpret_cast<const int32_t*>(Bytes+Header.LMOffset);
+  lm = vector<vector<int> >(Header.NModes, vector<int>(2,0));
+  for(unsigned int i_m=0; i_m<Header.NModes; ++i_m) {
+    lm[i_m][0] = LM[2*i_m];
+    lm[i_m][1] = LM[2*i_m+1];
+  }
+  UpdateLMIndex();
+
+  const double* T = reinterpret_cast<const double*>(Bytes+Header.TimeOffset);
+  t.assign(T, T+Header.NTimes);
+
+  const double* R = reinterpret_cast<const double*>(Bytes+Header.FrameOffset);
+  frame.resize(Header.NFrame);
+  for(unsigned int i_f=0; i_f<Header.NFrame; ++i_f) {
+    frame[i_f] = Quaternion(R[4*i_f], R[4*i_f+1], R[4*i_f+2], R[4*i_f+3]);
+  }
+
+  // The data block is used in place; the mapping is released when
+  // the last MatrixC referring to it goes away
+  complex<double>* Data = reinterpret_cast<complex<double>*>(static_cast<char*>(Map)+Header.DataOffset);
+  data = MatrixC::Adopt(Header.NModes, Header.NTimes, Data, std::shared_ptr<void>(Map, BinaryWaveformUnmapper(FileSize)));
+
+  return;
+}
+
+/// Open a binary Waveform file for chunk-by-chunk processing
+GWFrames::WaveformStream::WaveformStream(const std::string& FileName, const unsigned int ChunkSize)
+  : W(FileName, "Binary"), chunkSize(ChunkSize)
+{
+  ///
+  /// \param FileName File written by `Waveform::OutputBinary`
+  /// \param ChunkSize Number of time steps in each chunk
+  ///
+  /// Opening the file only reads the metadata, times, and frame; the
+  /// mode data are read from disk (by the operating system) as each
+  /// chunk is touched, and may be dropped from memory again once that
+  /// chunk is finished.
+  if(chunkSize==0) {
+    INFOTOCERR << "\nError: ChunkSize must be positive." << std::endl;
+    throw(GWFrames_ValueError);
+  }
+}
+
+/// Waveform holding all of the metadata of the source, but no modes
+GWFrames::Waveform GWFrames::WaveformStream::Metadata() const {
+  Waveform Meta = W.CopyWithoutData();
+  Meta.history.str(W.history.str());
+  Meta.history.clear();
+  Meta.history.seekp(0, ios_base::end);
+  Meta.t = W.t;
+  Meta.frame = W.frame;
+  Meta.data.resize(0, W.NTimes());
+  return Meta;
+}
+
+/// Copy of the data in one chunk, with optional halo
+GWFrames::Waveform GWFrames::WaveformStream::Chunk(const unsigned int i_chunk, const unsigned int Halo) const {
+  ///
+  /// \param i_chunk Index of the chunk
+  /// \param Halo Number of extra time steps to include on each side
+  ///
+  /// The halo is truncated at the beginning and end of the data.
+  if(i_chunk>=NChunks()) {
+    INFOTOCERR << "\nError: Asking for chunk " << i_chunk << " of a WaveformStream with " << NChunks() << " chunks." << std::endl;
+    throw(GWFrames_IndexOutOfBounds);
+  }
+  const unsigned int i_a = i_chunk*chunkSize;
+  const unsigned int i_b = std::min(i_a+chunkSize, NTimes());
+  return W.SliceOfTimeIndices((i_a>Halo ? i_a-Halo : 0), std::min(i_b+Halo, NTimes()));
+}
+
+/// Rotate the decomposition basis by a constant rotor, writing the result to file
+const GWFrames::WaveformStream& GWFrames::WaveformStream::RotateDecompositionBasis(const Quaternions::Quaternion& R_frame,
+                                                                                   const std::string& OutputFileName) const {
+  return RotateDecompositionBasis(vector<Quaternion>(1, R_frame), OutputFileName);
+}
+
+/// Rotate the decomposition basis by a time-dependent rotor, writing the result to file
+const GWFrames::WaveformStream& GWFrames::WaveformStream::RotateDecompositionBasis(const std::vector<Quaternions::Quaternion>& R_frame,
+                                                                                   const std::string& OutputFileName) const {
+  ///
+  /// \param R_frame Rotors (one, or one for each time step)
+  /// \param OutputFileName Binary file to which the result is written
+  ///
+  /// \sa Waveform::RotateDecompositionBasis
+  if(R_frame.size()!=1 && R_frame.size()!=NTimes()) {
+    INFOTOCERR << "\nError: (R_frame.size()=" << R_frame.size() << ") != (NTimes()=" << NTimes() << ")" << std::endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  Waveform Meta = Metadata();
+  if(R_frame.size()==1) {
+    Meta.RotateDecompositionBasis(R_frame[0]);
+  } else {
+    Meta.RotateDecompositionBasis(R_frame);
+  }
+  Meta.lm = W.lm;
+  Meta.lmIndex = W.lmIndex;
+
+  BinaryWaveformFileWriter Out(OutputFileName, Meta, Meta.HistoryStr() + "this->OutputBinary(" + OutputFileName + ")\n");
+  for(unsigned int i_chunk=0; i_chunk<NChunks(); ++i_chunk) {
+    const unsigned int i_a = i_chunk*chunkSize;
+    Waveform C = Chunk(i_chunk);
+    if(R_frame.size()==1) {
+      C.TransformModesToRotatedFrame(R_frame);
+    } else {
+      C.TransformModesToRotatedFrame(vector<Quaternion>(R_frame.begin()+i_a, R_frame.begin()+i_a+C.NTimes()));
+    }
+    for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
+      std::copy(C.data[i_m], C.data[i_m]+C.NTimes(), Out(i_m, i_a));
+    }
+  }
+  return *this;
+}
+
+/// Differentiate with respect to time, writing the result to file
+const GWFrames::WaveformStream& GWFrames::WaveformStream::Differentiate(const std::string& OutputFileName) const {
+  ///
+  /// \param OutputFileName Binary file to which the result is written
+  ///
+  /// Each chunk is differentiated along with two time steps on
+  /// either side, which is all the finite-difference stencil of
+  /// `ComplexDerivative` reaches, so the result is identical to that
+  /// of `Waveform::Differentiate`.
+  ///
+  /// \sa Waveform::Differentiate
+  Waveform Meta = Metadata();
+  Meta.Differentiate();
+  Meta.lm = W.lm;
+  Meta.lmIndex = W.lmIndex;
+
+  const unsigned int N = NTimes();
+  BinaryWaveformFileWriter Out(OutputFileName, Meta, Meta.HistoryStr() + "this->OutputBinary(" + OutputFileName + ")\n");
+  for(unsigned int i_chunk=0; i_chunk<NChunks(); ++i_chunk) {
+    const unsigned int i_a = i_chunk*chunkSize;
+    const unsigned int i_b = std::min(i_a+chunkSize, N);
+    // The interior stencil needs two points on either side; windows
+    // shorter than five points would switch to a different formula
+    unsigned int i_lo = (i_a>2 ? i_a-2 : 0);
+    unsigned int i_hi = std::min(i_b+2, N);
+    while(i_hi-i_lo<5 && i_hi<N) { ++i_hi; }
+    while(i_hi-i_lo<5 && i_lo>0) { --i_lo; }
+    const Waveform C = W.SliceOfTimeIndices(i_lo, i_hi);
+    for(unsigned int i_m=0; i_m<C.NModes(); ++i_m) {
+      const vector<complex<double> > dDdt = C.DataDot(i_m);
+      std::copy(dDdt.begin()+(i_a-i_lo), dDdt.begin()+(i_b-i_lo), Out(i_m, i_a));
+    }
+  }
+  return *this;
+}
+
+/// Return the norm (sum of squares of modes) of the waveform
+std::vector<double> GWFrames::WaveformStream::Norm(const bool TakeSquareRoot) const {
+  ///
+  /// \sa Waveform::Norm
+  vector<double> norm;
+  norm.reserve(NTimes());
+  for(unsigned int i_chunk=0; i_chunk<NChunks(); ++i_chunk) {
+    const vector<double> norm_chunk = Chunk(i_chunk).Norm(TakeSquareRoot);
+    norm.insert(norm.end(), norm_chunk.begin(), norm_chunk.end());
+  }
+  return norm;
+}
+
+/// Evaluate the waveform at a point, as a function of time
+std::vector<std::complex<double> > GWFrames::WaveformStream::EvaluateAtPoint(const double vartheta, const double varphi) const {
+  ///
+  /// \sa Waveform::EvaluateAtPoint
+  vector<complex<double> > f;
+  f.reserve(NTimes());
+  for(unsigned int i_chunk=0; i_chunk<NChunks(); ++i_chunk) {
+    const unsigned int i_a = i_chunk*chunkSize;
+    const unsigned int i_b = std::min(i_a+chunkSize, NTimes());
+    const vector<complex<double> > f_chunk = W.EvaluateAtPoint(vartheta, varphi, i_a, i_b);
+    f.insert(f.end(), f_chunk.begin(), f_chunk.end());
+  }
+  return f;
+}
+
+/// Write the data to a text file, in the format of Waveform::Output
+const GWFrames::WaveformStream& GWFrames::WaveformStream::Output(const std::string& FileName, const unsigned int precision) const {
+  const std::string Descriptor = W.DescriptorString();
+  const unsigned int NModes = this->NModes();
+  ofstream ofs(FileName.c_str(), ofstream::out);
+  ofs << setprecision(precision) << flush;
+  ofs << W.HistoryStr() << "this->Output(" << FileName << ", " << precision << ")" << endl;
+  ofs << "# [1] = Time" << endl;
+  for(unsigned int i_m=0; i_m<NModes; ++i_m) {
+    ofs << "# [" << 2*i_m+2 << "] = Re{" << Descriptor << "(" << W.lm[i_m][0] << "," << W.lm[i_m][1] << ")}" << endl;
+    ofs << "# [" << 2*i_m+3 << "] = Im{" << Descriptor << "(" << W.lm[i_m][0] << "," << W.lm[i_m][1] << ")}" << endl;
+  }
+  for(unsigned int i_chunk=0; i_chunk<NChunks(); ++i_chunk) {
+    const Waveform C = Chunk(i_chunk);
+    for(unsigned int i_t=0; i_t<C.NTimes(); ++i_t) {
+      ofs << C.T(i_t);
+      for(unsigned int i_m=0; i_m<NModes; ++i_m) {
+        ofs << " " << C.data[i_m][i_t].real() << " " << C.data[i_m][i_t].imag();
+      }
+      ofs << "\n";
+    }
+  }
+  ofs.close();
+  return *this;
+}
+
+/// Add another Waveform to this one, in place
+GWFrames::Waveform& GWFrames::Waveform::operator+=(const GWFrames::Waveform& B) {
+  ///
+  /// \param B Waveform with the same spin weight, frame, and times
+  ///
+  /// Each mode of this Waveform is incremented by the corresponding
+  /// mode of B, without allocating new data.
   const Waveform& A = *this;
 
   if(A.spinweight != B.spinweight) {
@@ -3954,28 +6053,33 @@ GWFrames::Waveform GWFrames::Waveform::operator+(const GWFrames::Waveform& B) co
     throw(GWFrames_MatrixSizeMismatch);
   }
 
-  // This will be the new object holding the multiplied data
-  GWFrames::Waveform C(A);
-
-  // Store both old histories in C's
-  C.history << "*this = *this+B\n"
-            << "#### B.history.str():\n" << B.history.str()
-            << "#### End of old histories from `A+B`" << std::endl;
+  // Store the old history of B in this one's
+  history << "*this += B\n"
+          << "#### B.history.str():\n" << B.history.str()
+          << "#### End of old histories from `A+B`" << std::endl;
 
   // Do the work of addition
   const unsigned int ntimes = NTimes();
   const unsigned int nmodes = NModes();
   for(unsigned int i_A=0; i_A<nmodes; ++i_A) {
     const unsigned int i_B = B.FindModeIndex(lm[i_A][0], lm[i_A][1]);
+    std::complex<double>* a = data[i_A];
+    const std::complex<double>* b = B.data[i_B];
     for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
-      C.SetData(i_A, i_t, A.Data(i_A,i_t)+B.Data(i_B,i_t));
+      a[i_t] += b[i_t];
     }
   }
 
-  return C;
+  return *this;
 }
 
-GWFrames::Waveform GWFrames::Waveform::operator-(const GWFrames::Waveform& B) const {
+/// Subtract another Waveform from this one, in place
+GWFrames::Waveform& GWFrames::Waveform::operator-=(const GWFrames::Waveform& B) {
+  ///
+  /// \param B Waveform with the same spin weight, frame, and times
+  ///
+  /// Each mode of this Waveform is decremented by the corresponding
+  /// mode of B, without allocating new data.
   const Waveform& A = *this;
 
   if(A.spinweight != B.spinweight) {
@@ -4008,66 +6112,97 @@ GWFrames::Waveform GWFrames::Waveform::operator-(const GWFrames::Waveform& B) co
     throw(GWFrames_MatrixSizeMismatch);
   }
 
-  // This will be the new object holding the multiplied data
-  GWFrames::Waveform C(A);
-
-  // Store both old histories in C's
-  C.history << "*this = *this-B\n"
-            << "#### B.history.str():\n" << B.history.str()
-            << "#### End of old histories from `A-B`" << std::endl;
+  // Store the old history of B in this one's
+  history << "*this -= B\n"
+          << "#### B.history.str():\n" << B.history.str()
+          << "#### End of old histories from `A-B`" << std::endl;
 
-  // Do the work of addition
+  // Do the work of subtraction
   const unsigned int ntimes = NTimes();
   const unsigned int nmodes = NModes();
   for(unsigned int i_A=0; i_A<nmodes; ++i_A) {
     const unsigned int i_B = B.FindModeIndex(lm[i_A][0], lm[i_A][1]);
+    std::complex<double>* a = data[i_A];
+    const std::complex<double>* b = B.data[i_B];
     for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
-      C.SetData(i_A, i_t, A.Data(i_A,i_t)-B.Data(i_B,i_t));
+      a[i_t] -= b[i_t];
     }
   }
 
-  return C;
+  return *this;
 }
 
-GWFrames::Waveform GWFrames::Waveform::operator*(const double b) const {
-  const Waveform& A = *this;
-
-  // This will be the new object holding the multiplied data
-  GWFrames::Waveform C(A);
-
+/// Multiply this Waveform by a constant, in place
+GWFrames::Waveform& GWFrames::Waveform::operator*=(const double b) {
   // Record the activity
-  C.history << "*this = (*this) * " << b << std::endl;
+  history << "*this = (*this) * " << b << std::endl;
 
-  // Do the work of addition
   const unsigned int ntimes = NTimes();
   const unsigned int nmodes = NModes();
-  for(unsigned int i_A=0; i_A<nmodes; ++i_A) {
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    std::complex<double>* a = data[i_m];
     for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
-      C.SetData(i_A, i_t, A.Data(i_A,i_t)*b);
+      a[i_t] *= b;
     }
   }
 
-  return C;
+  return *this;
 }
 
-GWFrames::Waveform GWFrames::Waveform::operator/(const double b) const {
-  const Waveform& A = *this;
-
-  // This will be the new object holding the multiplied data
-  GWFrames::Waveform C(A);
-
+/// Divide this Waveform by a constant, in place
+GWFrames::Waveform& GWFrames::Waveform::operator/=(const double b) {
   // Record the activity
-  C.history << "*this = (*this) / " << b << std::endl;
+  history << "*this = (*this) / " << b << std::endl;
 
-  // Do the work of addition
   const unsigned int ntimes = NTimes();
   const unsigned int nmodes = NModes();
-  for(unsigned int i_A=0; i_A<nmodes; ++i_A) {
+  for(unsigned int i_m=0; i_m<nmodes; ++i_m) {
+    std::complex<double>* a = data[i_m];
     for(unsigned int i_t=0; i_t<ntimes; ++i_t) {
-      C.SetData(i_A, i_t, A.Data(i_A,i_t)/b);
+      a[i_t] /= b;
     }
   }
 
+  return *this;
+}
+
+/// Pointwise multiply this Waveform by another
+GWFrames::Waveform& GWFrames::Waveform::operator*=(const GWFrames::Waveform& B) {
+  /// The product has a different spin weight and set of modes, so
+  /// new data are computed, and then moved into this object.
+  *this = BinaryOp<std::multiplies<std::complex<double> > >(B);
+  return *this;
+}
+
+/// Pointwise divide this Waveform by another
+GWFrames::Waveform& GWFrames::Waveform::operator/=(const GWFrames::Waveform& B) {
+  /// The quotient has a different spin weight and set of modes, so
+  /// new data are computed, and then moved into this object.
+  *this = BinaryOp<std::divides<std::complex<double> > >(B);
+  return *this;
+}
+
+GWFrames::Waveform GWFrames::Waveform::operator+(const GWFrames::Waveform& B) const {
+  GWFrames::Waveform C(*this);
+  C += B;
+  return C;
+}
+
+GWFrames::Waveform GWFrames::Waveform::operator-(const GWFrames::Waveform& B) const {
+  GWFrames::Waveform C(*this);
+  C -= B;
+  return C;
+}
+
+GWFrames::Waveform GWFrames::Waveform::operator*(const double b) const {
+  GWFrames::Waveform C(*this);
+  C *= b;
+  return C;
+}
+
+GWFrames::Waveform GWFrames::Waveform::operator/(const double b) const {
+  GWFrames::Waveform C(*this);
+  C /= b;
   return C;
 }
 
@@ -36,6 +36,13 @@ namespace GWFrames {
   static const std::string WaveformDataNamesLaTeX[8] = { "\\mathrm{unknown data type}", "h", "\\dot{h}", "\\Psi_4", "\\Psi_3", "\\Psi_2", "\\Psi_1", "\\Psi_0" };
   const int WeightError = 1000;
 
+  /// Angular-momentum quantities returned by Waveform::AngularVelocityWithDiagnostics
+  struct AngularVelocityDiagnostics {
+    std::vector<std::vector<double> > Ldt;   // <L dt> at each time step (3 components)
+    std::vector<std::vector<double> > LL;    // <LL> at each time step (xx, xy, xz, yy, yz, zz)
+    std::vector<std::vector<double> > Omega; // Angular velocity at each time step (3 components)
+  };
+
   /// Object storing data and other information for a single waveform
   class Waveform {
 
@@ -51,16 +58,26 @@ namespace GWFrames {
     bool rIsScaledOut;
     bool mIsScaledOut;
     std::vector<std::vector<int> > lm;
+    std::vector<int> lmIndex; // lmIndex[ell*(ell+1)+m] is the row of data holding (ell,m), or -1
     MatrixC data; // Each row (first index, nn) corresponds to a mode
 
+  protected:  // Must be called whenever lm changes
+    void UpdateLMIndex();
+
+  protected:  // Shared by the interpolation methods
+    Waveform InterpolationTarget(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain,
+                                 const std::string& Call, unsigned int& i0, unsigned int& i1) const;
+
   public:  // Constructors and Destructor
     Waveform();
     Waveform(const Waveform& W);
+    Waveform(Waveform&& W);
     Waveform(const std::string& FileName, const std::string& DataFormat);
     Waveform(const std::vector<double>& T, const std::vector<std::vector<int> >& LM,
              const std::vector<std::vector<std::complex<double> > >& Data);
     ~Waveform() { }
     Waveform& operator=(const Waveform&);
+    Waveform& operator=(Waveform&&);
 
   public:  // Copy-ish constructoroids
     Waveform CopyWithoutData() const;
@@ -70,8 +87,12 @@ namespace GWFrames {
     Waveform SliceOfTimes(const double t_a=-1e300, const double t_b=1e300) const;
     Waveform SliceOfTimesWithEll2(const double t_a=-1e300, const double t_b=1e300) const;
     Waveform SliceOfTimesWithoutModes(const double t_a=-1e300, const double t_b=1e300) const;
+    Waveform SubsetOfTimeIndices(const std::vector<unsigned int>& Indices) const;
     Waveform Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain=false) const;
     Waveform& InterpolateInPlace(const std::vector<double>& NewTime);
+    Waveform InterpolateLocal(const std::vector<double>& NewTime, const unsigned int Order=5,
+                              const bool AllowTimesOutsideCurrentDomain=false) const;
+    Waveform Compress(const double Tolerance=1e-6) const;
 
   public: // Data alteration functions -- USE AT YOUR OWN RISK!
     Waveform& DropTimesOutside(const double ta, const double tb);
@@ -90,7 +111,7 @@ namespace GWFrames {
     inline Waveform& SetDataType(const WaveformDataType Type) { dataType = Type; return *this; }
     inline Waveform& SetRIsScaledOut(const bool Scaled) { rIsScaledOut = Scaled; return *this; }
     inline Waveform& SetMIsScaledOut(const bool Scaled) { mIsScaledOut = Scaled; return *this; }
-    inline Waveform& SetLM(const std::vector<std::vector<int> >& a) { lm = a; return *this; }
+    inline Waveform& SetLM(const std::vector<std::vector<int> >& a) { lm = a; UpdateLMIndex(); return *this; }
     inline Waveform& SetData(const std::vector<std::vector<std::complex<double> > >& a) { data = MatrixC(a); return *this; }
     inline Waveform& SetData(const unsigned int i_Mode, const unsigned int i_Time, const std::complex<double>& a) { data[i_Mode][i_Time] = a; return *this; }
     inline Waveform& ResizeData(const unsigned int NModes, const unsigned int NTimes) { data.resize(NModes, NTimes); return *this; }
@@ -263,6 +284,7 @@ namespace GWFrames {
     std::vector<std::vector<double> > LLDominantEigenvector(const std::vector<int>& Lmodes=std::vector<int>(0),
                                                             const Quaternions::Quaternion& RoughInitialEllDirection=Quaternions::zHat) const;
     std::vector<std::vector<double> > AngularVelocityVector(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
+    AngularVelocityDiagnostics AngularVelocityWithDiagnostics(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
     std::vector<std::vector<double> > AngularVelocityVectorRelativeToInertial(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
     std::vector<Quaternions::Quaternion> CorotatingFrame(const std::vector<int>& Lmodes=std::vector<int>(0)) const;
 
@@ -287,6 +309,8 @@ namespace GWFrames {
     // Pointwise operations and spin-weight operators
     std::vector<std::complex<double> > EvaluateAtPoint(const double vartheta, const double varphi,
                                                        const unsigned int i_0=0, int i_1=-1) const;
+    std::vector<std::vector<std::complex<double> > > EvaluateAtPoints(const std::vector<double>& vartheta, const std::vector<double>& varphi,
+                                                                      const unsigned int i_0=0, int i_1=-1) const;
     std::complex<double> InterpolateToPoint(const double vartheta, const double varphi, const double t_i,
                                             gsl_interp_accel* accRe=0, gsl_interp_accel* accIm=0, gsl_spline* splineRe=0, gsl_spline* splineIm=0) const;
     template <typename Op> Waveform BinaryOp(const Waveform& b) const;
@@ -296,6 +320,12 @@ namespace GWFrames {
     Waveform operator/(const Waveform& B) const;
     Waveform operator*(const double b) const;
     Waveform operator/(const double b) const;
+    Waveform& operator+=(const Waveform& B);
+    Waveform& operator-=(const Waveform& B);
+    Waveform& operator*=(const Waveform& B);
+    Waveform& operator/=(const Waveform& B);
+    Waveform& operator*=(const double b);
+    Waveform& operator/=(const double b);
 
     Waveform Translate(const std::vector<std::vector<double> >& deltax) const;
     Waveform& BoostPsi4(const std::vector<std::vector<double> >& v);
@@ -303,13 +333,221 @@ namespace GWFrames {
 
     // Output to data file
     const Waveform& Output(const std::string& FileName, const unsigned int precision=14) const;
+    const Waveform& OutputBinary(const std::string& FileName) const;
+
+  private:
+    void ReadBinary(const std::string& FileName);
+
+    friend class WaveformSpline;
+    friend class WaveformLocalInterpolant;
+    friend class WaveformStream;
+    friend class Hybridizer;
 
   }; // class Waveform
   inline Waveform operator*(const double b, const Waveform& A) { return A*b; }
+  #ifndef SWIG
+  // Temporaries can be reused as the result, rather than copied
+  inline Waveform operator+(Waveform&& A, const Waveform& B) { A += B; return std::move(A); }
+  inline Waveform operator-(Waveform&& A, const Waveform& B) { A -= B; return std::move(A); }
+  inline Waveform operator*(Waveform&& A, const double b) { A *= b; return std::move(A); }
+  inline Waveform operator/(Waveform&& A, const double b) { A /= b; return std::move(A); }
+  inline Waveform operator*(const double b, Waveform&& A) { A *= b; return std::move(A); }
+  #endif // SWIG
   #include "Waveforms_BinaryOp.ipp"
 
-  void AlignWaveforms(Waveform& A, Waveform& B, const double t_1, const double t_2, unsigned int InitialEvaluations=0,
-                      std::vector<double> nHat_A=std::vector<double>(0), const bool Debug=false);
+  #ifndef SWIG
+  /// Cubic-spline representation of a Waveform, for repeated interpolation
+  class WaveformSpline {
+    /// The spline is a natural cubic spline in time for the real and
+    /// imaginary parts of each mode -- the same spline used by GSL's
+    /// `gsl_interp_cspline`.  The second derivatives for all modes
+    /// are found once on construction; any number of new time grids
+    /// can then be evaluated without rebuilding anything.  Note that
+    /// this object refers to the input Waveform, which must outlive
+    /// it and must not be changed while the spline is in use.
+  public:
+    /// Interval indices and weights for a particular set of times
+    class Stencil {
+      friend class WaveformSpline;
+      std::vector<unsigned int> Index;
+      std::vector<double> A, B, C, D;
+    public:
+      inline unsigned int size() const { return Index.size(); }
+    };
+
+  private:
+    const Waveform& W;
+    MatrixC y2; // Second time derivatives of the data at each time step
+
+  public:
+    WaveformSpline(const Waveform& W);
+    ~WaveformSpline() { }
+
+    inline const Waveform& Source() const { return W; }
+    Stencil StencilAt(const std::vector<double>& NewTime) const;
+    Stencil StencilAt(const double* NewTime, const unsigned int N) const;
+    void EvaluateMode(const unsigned int Mode, const Stencil& S, std::complex<double>* Out) const;
+    Waveform Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain=false) const;
+  }; // class WaveformSpline
+
+  /// Local polynomial representation of a Waveform, for repeated interpolation
+  class WaveformLocalInterpolant {
+    /// Each new time is interpolated by the Lagrange polynomial
+    /// through the `Order+1` data points nearest to it, so that the
+    /// result at each time is a fixed linear combination of the data
+    /// at those points.  Those weights depend only on the times, so
+    /// they are found once per set of new times and applied to every
+    /// mode.  When the Waveform's times are uniformly spaced, the
+    /// interval is found directly, and the weights are found in
+    /// O(Order) operations from precomputed denominators.  Note that
+    /// this object refers to the input Waveform, which must outlive
+    /// it and must not be changed while it is in use.
+  public:
+    /// Stencil indices and weights for a particular set of times
+    class Stencil {
+      friend class WaveformLocalInterpolant;
+      std::vector<unsigned int> Index;
+      std::vector<double> Weights;
+    public:
+      inline unsigned int size() const { return Index.size(); }
+    };
+
+  private:
+    const Waveform& W;
+    unsigned int NPoints;
+    bool Uniform;
+    double t0, dt;
+    std::vector<double> InverseDenominators; // For uniformly spaced times
+
+  public:
+    WaveformLocalInterpolant(const Waveform& W, const unsigned int Order=5);
+    ~WaveformLocalInterpolant() { }
+
+    inline const Waveform& Source() const { return W; }
+    inline unsigned int Order() const { return NPoints-1; }
+    inline bool UniformTimes() const { return Uniform; }
+    Stencil StencilAt(const std::vector<double>& NewTime) const;
+    Stencil StencilAt(const double* NewTime, const unsigned int N) const;
+    void EvaluateMode(const unsigned int Mode, const Stencil& S, std::complex<double>* Out) const;
+    Waveform Interpolate(const std::vector<double>& NewTime, const bool AllowTimesOutsideCurrentDomain=false) const;
+  }; // class WaveformLocalInterpolant
+  #endif // SWIG
+
+  /// Hybridization of many early Waveforms with one fixed late Waveform
+  class Hybridizer {
+    /// Everything in `A.Hybridize(B, t1, t2, tMinStep)` that does not
+    /// depend on the data of `A` is found once on construction: the
+    /// output times, the blending weights, the frame and data of `B`
+    /// interpolated to the output times, and the interpolation
+    /// weights for Waveforms with times `TA`.  Each call to
+    /// `Hybridize` then just fits the spline for `A` and blends.  For
+    /// an input with times `TA`, the result is the same as
+    /// `A.Hybridize(B, t1, t2, tMinStep)`; other inputs are
+    /// interpolated to the same output times, which they must cover.
+  private:
+    Waveform B; // The metadata of the late Waveform, without its data
+    double t1, t2, tMinStep;
+    std::vector<double> TA;
+    std::vector<double> t;
+    unsigned int J01, J12;
+    std::vector<double> Transition;
+    #ifndef SWIG
+    WaveformSpline::Stencil SA;
+    #endif // SWIG
+    std::vector<Quaternions::Quaternion> Bframe;
+    MatrixC Bdata;
+
+  public:
+    Hybridizer(const Waveform& B, const std::vector<double>& TA, const double t1, const double t2, const double tMinStep=0.005);
+
+    inline const std::vector<double>& T() const { return t; }
+    Waveform Hybridize(const Waveform& A) const;
+  }; // class Hybridizer
+
+  /// Squad interpolant of a time series of rotors, for repeated evaluation
+  class RotorTimeSeries {
+    /// The control points of `Quaternions::Squad` depend only on the
+    /// input rotors and times, so they are found once on
+    /// construction.  Evaluation on any number of new time grids then
+    /// costs just a few exponentials per point.  Because Squad is
+    /// covariant under constant rotations on either side, the result
+    /// for the rotors `R_left * R * R_right` is obtained by applying
+    /// those constants to the result, with no need to recompute the
+    /// control points.
+  private:
+    std::vector<double> t;
+    std::vector<Quaternions::Quaternion> R, A, B, LogR, LogAB;
+    unsigned int Interval(const double t_i, unsigned int j) const;
+    Quaternions::Quaternion Evaluate(const double t_i, const unsigned int j) const;
+
+  public:
+    RotorTimeSeries(const std::vector<Quaternions::Quaternion>& R, const std::vector<double>& T);
+    RotorTimeSeries(const Waveform& W);
+
+    inline unsigned int NTimes() const { return t.size(); }
+    inline const std::vector<double>& T() const { return t; }
+    inline const std::vector<Quaternions::Quaternion>& Rotors() const { return R; }
+    Quaternions::Quaternion Evaluate(const double t_i) const;
+    std::vector<Quaternions::Quaternion> Evaluate(const std::vector<double>& NewTime, const double Offset=0.0) const;
+    std::vector<Quaternions::Quaternion> Evaluate(const std::vector<double>& NewTime, const double Offset,
+                                                  const Quaternions::Quaternion& R_left, const Quaternions::Quaternion& R_right) const;
+  }; // class RotorTimeSeries
+
+  /// Chunk-by-chunk processing of a Waveform stored in a binary file
+  class WaveformStream {
+    /// The source is a file written by `Waveform::OutputBinary`.  The
+    /// time and frame data are held in memory, but the mode data are
+    /// only mapped from the file, and are processed in blocks of
+    /// `ChunkSize()` time steps, so that only a few chunks need ever be
+    /// resident at once.  Results with the same number of time steps
+    /// as the input are written to new binary files (which may be
+    /// opened with another WaveformStream), rather than returned.
+    /// Each chunk produces exactly the same numbers as the
+    /// corresponding operation on the complete Waveform.
+  private:
+    Waveform W;
+    unsigned int chunkSize;
+    Waveform Metadata() const;
+
+  public:
+    WaveformStream(const std::string& FileName, const unsigned int ChunkSize=16384);
+
+    inline unsigned int NTimes() const { return W.NTimes(); }
+    inline unsigned int NModes() const { return W.NModes(); }
+    inline unsigned int ChunkSize() const { return chunkSize; }
+    inline unsigned int NChunks() const { return (NTimes()+chunkSize-1)/chunkSize; }
+    inline const std::vector<double>& T() const { return W.T(); }
+    inline const std::vector<std::vector<int> >& LM() const { return W.LM(); }
+    Waveform Chunk(const unsigned int i_chunk, const unsigned int Halo=0) const;
+
+    const WaveformStream& RotateDecompositionBasis(const Quaternions::Quaternion& R_frame, const std::string& OutputFileName) const;
+    const WaveformStream& RotateDecompositionBasis(const std::vector<Quaternions::Quaternion>& R_frame, const std::string& OutputFileName) const;
+    const WaveformStream& Differentiate(const std::string& OutputFileName) const;
+    std::vector<double> Norm(const bool TakeSquareRoot=false) const;
+    std::vector<std::complex<double> > EvaluateAtPoint(const double vartheta, const double varphi) const;
+    const WaveformStream& Output(const std::string& FileName, const unsigned int precision=14) const;
+  }; // class WaveformStream
+
+  /// Wall-clock times and iteration counts for the stages of `AlignWaveforms`
+  struct AlignWaveformsStatistics {
+    double ScanTime;                           // Seconds spent on the initial scan over deltat
+    unsigned int ScanEvaluations;              // Number of values of deltat in that scan
+    double OptimizationTime;                   // Seconds spent on the (concurrent) optimization of all branches
+    std::vector<double> BranchTimes;           // Seconds spent on each of the four branches (0 if not tried)
+    std::vector<unsigned int> BranchIterations; // Optimizer iterations for each of the four branches
+    std::vector<double> BranchUpsilon;         // Value of the objective function for each of the four branches
+    double TotalTime;                          // Seconds spent in `AlignWaveforms` altogether
+    int Error;                                 // Error code thrown while aligning, in `AlignWaveformsBatch` (0 for success)
+  };
+
+  AlignWaveformsStatistics AlignWaveforms(Waveform& A, Waveform& B, const double t_1, const double t_2, unsigned int InitialEvaluations=0,
+                                          std::vector<double> nHat_A=std::vector<double>(0), const bool Debug=false,
+                                          const bool GradientOptimizer=false, const bool FFTScan=false);
+  std::vector<AlignWaveformsStatistics> AlignWaveformsBatch(const std::vector<Waveform>& As, const std::vector<Waveform>& Bs,
+                                                           const std::vector<double>& t_1s, const std::vector<double>& t_2s,
+                                                           std::vector<Waveform>& AlignedAs, std::vector<Waveform>& AlignedBs,
+                                                           unsigned int InitialEvaluations=0, const bool GradientOptimizer=false,
+                                                           const bool FFTScan=false);
 
 } // namespace GWFrames
 
@@ -6,6 +6,8 @@
 #include "Errors.hpp"
 
 #include "Waveforms.hpp"
+#include "Quaternions.hpp"
+#include "SphericalFunctions/SWSHs.hpp"
 #include <complex>
 
 namespace WU = WaveformUtilities;
@@ -19,7 +21,6 @@ using GWFrames::operator-;
 
 namespace {
 
-  double sqr(const double& a) { return a*a; }
   double cube(const double& a) { return a*a*a; }
 
   double BumpFunction(const double x, const double x0, const double x1) {
@@ -35,6 +36,124 @@ namespace {
   //   return i*df - N*df;
   // }
 
+  // Conversion of time to seconds from geometric units
+  double TotalMassInSeconds(const double TotalMass) {
+    // Fundamental constants
+    const double G    = 6.67259e-11;     // Units of m^3 kg^-1 s^-2
+    const double c    = 299792458;       // Units of m / s
+    const double Msol = 1.98892e30;      // Units of kg
+    return TotalMass * Msol * G / cube(c);
+  }
+
+  // An even time spacing Dt, starting at the first time of W, whose
+  // size is the next length for which FFTs are fast (not necessarily
+  // a power of 2), zero padded for additional powers of 2 if
+  // requested (may be needed for more fine-grained control of time
+  // and phase offsets)
+  vector<double> UniformTimes(const GWFrames::Waveform& W, const double Dt, const unsigned int ExtraZeroPadPowers) {
+    const unsigned int N1 = (unsigned int)(std::floor((W.T().back()-W.T(0))/Dt));
+    const unsigned int N2 = WU::NextFastFFTSize(N1) << ExtraZeroPadPowers;
+    vector<double> NewTimes(N2);
+    for(unsigned int i=0; i<N2; ++i) {
+      NewTimes[i] = W.T(0) + i*Dt;
+    }
+    return NewTimes;
+  }
+
+  // The window which is zero up to the first zero crossing of RealT
+  // (for continuity), and rises smoothly to one over the following
+  // 2*WindowNCycles zero crossings
+  vector<double> Window(const vector<double>& RealT, const vector<double>& Times, const unsigned int WindowNCycles) {
+    unsigned int i=0;
+    const double Sign = RealT[0] / std::abs(RealT[0]);
+    while(RealT[i++]*Sign>0) { }
+    const double t0 = Times[i];
+    for(unsigned int j=0; j<WindowNCycles; ++j) {
+      while(RealT[i++]*Sign<0) { }
+      while(RealT[i++]*Sign>0) { }
+    }
+    const double t1 = Times[i];
+    vector<double> W(Times.size(), 1.0);
+    for(unsigned int j=0; j<=i; ++j) {
+      W[j] = BumpFunction(Times[j], t0, t1);
+    }
+    return W;
+  }
+
+}
+
+GWFrames::WaveformModesFT::WaveformModesFT(const GWFrames::Waveform& W,
+                                           const double Dt,
+                                           const double TotalMass,
+                                           const unsigned int WindowNCycles,
+                                           const unsigned int ExtraZeroPadPowers)
+  : mDt(Dt), mDt_dimensionful(0.0), mSpinWeight(W.SpinWeight()), mNTimes(0), mLM(), mFreqs(), mData()
+{
+  /// \param W Waveform whose modes will be transformed
+  /// \param Dt Time step (in units of the total mass) of the uniform grid
+  /// \param TotalMass Total mass in solar masses
+  /// \param WindowNCycles Number of cycles over which the data are windowed
+  /// \param ExtraZeroPadPowers Additional powers of 2 for zero padding
+  ///
+  /// The modes are rotated into the inertial frame (which requires
+  /// every m for each ell present), interpolated to the uniform grid
+  /// just once, windowed, and transformed.  Each WaveformAtAPointFT
+  /// constructed from this object then costs only O(NModes*NTimes)
+  /// operations, with no further interpolation or FFTs.  The window
+  /// is the same for every point, and is found from the zero
+  /// crossings of the real part of the largest mode, rather than of
+  /// the signal at each point.  Note that the memory required is
+  /// that of a complex time series for every mode.
+
+  // Rotate into the inertial frame, so that the SWSHs are independent of time
+  GWFrames::Waveform W_inertial(W);
+  if(W_inertial.Frame().size()==1) {
+    W_inertial.RotateDecompositionBasis(W_inertial.Frame(0).inverse());
+  } else if(W_inertial.Frame().size()>1) {
+    W_inertial.TransformToInertialFrame();
+  }
+
+  const vector<double> NewTimes = UniformTimes(W_inertial, Dt, ExtraZeroPadPowers);
+  const GWFrames::Waveform W2 = W_inertial.Interpolate(NewTimes, true);
+  const unsigned int NM = W2.NModes();
+  const unsigned int N = NewTimes.size();
+  mNTimes = N;
+  mLM = W2.LM();
+
+  // Find the window from the largest mode
+  vector<double> Windowing;
+  {
+    unsigned int i_max = 0;
+    double Norm_max = -1.0;
+    for(unsigned int i_m=0; i_m<NM; ++i_m) {
+      double Norm = 0.0;
+      for(unsigned int i_t=0; i_t<N; ++i_t) {
+        Norm += std::norm(W2.Data(i_m, i_t));
+      }
+      if(Norm>Norm_max) { Norm_max = Norm; i_max = i_m; }
+    }
+    vector<double> RealT(N);
+    for(unsigned int i_t=0; i_t<N; ++i_t) {
+      RealT[i_t] = W2.Re(i_max, i_t);
+    }
+    Windowing = Window(RealT, NewTimes, WindowNCycles);
+  }
+
+  // Window and transform each mode
+  mData.resize(std::size_t(NM)*N);
+  vector<complex<double> > Mode(N);
+  for(unsigned int i_m=0; i_m<NM; ++i_m) {
+    for(unsigned int i_t=0; i_t<N; ++i_t) {
+      Mode[i_t] = W2.Data(i_m, i_t) * Windowing[i_t];
+    }
+    WU::dft(Mode);
+    std::copy(Mode.begin(), Mode.end(), mData.begin()+std::size_t(i_m)*N);
+  }
+
+  // Set up the frequency domain (in Hz)
+  const double MassInSeconds = TotalMassInSeconds(TotalMass);
+  mDt_dimensionful = Dt * MassInSeconds;
+  mFreqs = WU::TimeToPositiveFrequencies(MassInSeconds * NewTimes);
 }
 
 GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::Waveform& W,
@@ -48,20 +167,15 @@ GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::Waveform& W,
                                                  const unsigned int ExtraZeroPadPowers)
 : mDt(Dt), mVartheta(Vartheta), mVarphi(Varphi), mNormalized(false)
 {
+  const vector<double> NewTimes = UniformTimes(W, Dt, ExtraZeroPadPowers);
 
-  // Interpolate to an even time spacing dt whose size is the next power of 2
-  // Then zero pad for additional powers of 2 if requested (may be needed for
-  // more fine-grained control of time and phase offsets)
-  const unsigned int N1 = (unsigned int)(std::floor((W.T().back()-W.T(0))/Dt));
-  const unsigned int NPow = ceil(log2(N1)) + ExtraZeroPadPowers;
-  const unsigned int N2 = (unsigned int)(std::pow(2.0, double(NPow)));
-  vector<double> NewTimes(N2);
-  for(unsigned int i=0; i<N2; ++i) {
-    NewTimes[i] = W.T(0) + i*Dt;
-  }
-
-  GWFrames::Waveform W2 = W.Interpolate(NewTimes, true);
-  const vector<complex<double> > ComplexHData = W2.EvaluateAtPoint(Vartheta, Varphi);
+  // Evaluate at the point on the original time grid, and then
+  // interpolate just that one series to the new times (with zeros
+  // outside the original domain)
+  const vector<complex<double> > ComplexHData =
+    GWFrames::Waveform(W.T(), vector<vector<int> >(1, vector<int>(2, 0)),
+                       vector<vector<complex<double> > >(1, W.EvaluateAtPoint(Vartheta, Varphi)))
+    .Interpolate(NewTimes, true).Data(0);
 
   // Construct initial real,imag H as a function of time
   vector<double> InitRealT(ComplexHData.size());
@@ -83,58 +197,95 @@ GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::Waveform& W,
   }
 
   {
-    // Zero up to the first zero crossing for continuity
-    unsigned int i=0;
-    const double Sign = RealT[0] / std::abs(RealT[0]);
-    while(RealT[i++]*Sign>0) { }
-    for(unsigned int j=0; j<i; ++j) {
-      RealT[j] = 0.0;
-    }
-    // Now find the following 2*N zero crossings
-    const unsigned int i0 = i;
-    const double t0 = NewTimes[i0];
-    for(unsigned int j=0; j<WindowNCycles; ++j) {
-      while(RealT[i++]*Sign<0) { }
-      while(RealT[i++]*Sign>0) { }
-    }
-    // And window the data
-    const unsigned int i1 = i;
-    const double t1 = NewTimes[i1];
-    for(unsigned int j=i0; j<=i1; j++) {
-      RealT[j] *= BumpFunction(NewTimes[j], t0, t1);
+    // Window the data
+    const vector<double> Windowing = Window(RealT, NewTimes, WindowNCycles);
+    for(unsigned int j=0; j<RealT.size(); ++j) {
+      RealT[j] *= Windowing[j];
     }
   }
 
   // Set up the frequency domain (in Hz)
-  double Dt_dimensionful = 0.0;
-  {
-    // Conversion of time to seconds from geometric units
-    // Fundamental constants
-    const double G    = 6.67259e-11;     // Units of m^3 kg^-1 s^-2
-    const double c    = 299792458;       // Units of m / s
-    const double Msol = 1.98892e30;      // Units of kg
-    const double TotalMassInSeconds = TotalMass * Msol * G / cube(c);
-    Dt_dimensionful = Dt * TotalMassInSeconds;
-    const vector<double> PhysicalTimes = TotalMassInSeconds * NewTimes;
-    mFreqs = WU::TimeToPositiveFrequencies(PhysicalTimes);
-  }
+  const double MassInSeconds = TotalMassInSeconds(TotalMass);
+  const double Dt_dimensionful = Dt * MassInSeconds;
+  mFreqs = WU::TimeToPositiveFrequencies(MassInSeconds * NewTimes);
 
   // Construct real,imag H as a function of frequency
-  // The return from realdft needs to be multiplied by dt to correspond to the continuum FT
-  WU::realdft(RealT);
-  if (mFreqs.size() != RealT.size()/2+1) {
+  // The return from rdft needs to be multiplied by dt to correspond to the continuum FT
+  const vector<complex<double> > ComplexF = WU::rdft(RealT);
+  if (mFreqs.size() != ComplexF.size()) {
     cerr << "Time and frequency data size mismatch: "
-         << mFreqs.size() << "," << RealT.size()/2+1 << endl;
+         << mFreqs.size() << "," << ComplexF.size() << endl;
     throw(GWFrames_VectorSizeMismatch);
   }
   mRealF.resize(mFreqs.size());
   mImagF.resize(mFreqs.size());
-  for(unsigned int i=0; i<RealT.size()/2; ++i) {
-    mRealF[i] = Dt_dimensionful*RealT[2*i];
-    mImagF[i] = Dt_dimensionful*RealT[2*i+1];
+  for(unsigned int i=0; i<ComplexF.size(); ++i) {
+    mRealF[i] = Dt_dimensionful*ComplexF[i].real();
+    mImagF[i] = Dt_dimensionful*ComplexF[i].imag();
+  }
+  mRealF.back() = 0.0; // just ignore data at the Nyquist frequency
+  mImagF.back() = 0.0;
+  mImagF[0] = 0.0;
+}
+
+GWFrames::WaveformAtAPointFT::WaveformAtAPointFT(const GWFrames::WaveformModesFT& Modes,
+                                                 const double Vartheta,
+                                                 const double Varphi,
+                                                 const double DetectorResponseAmp,
+                                                 const double DetectorResponsePhase)
+: mDt(Modes.Dt()), mVartheta(Vartheta), mVarphi(Varphi), mFreqs(Modes.F()), mNormalized(false)
+{
+  /// \param Modes Transformed modes of the waveform
+  /// \param Vartheta Polar angle of the point
+  /// \param Varphi Azimuthal angle of the point
+  /// \param DetectorResponseAmp Amplitude of the complex detector response
+  /// \param DetectorResponsePhase Phase of the complex detector response
+  ///
+  /// With the complex response c and the modes h_lm, the detector
+  /// sees Re(c H) = (c H + c* H*)/2, where H = sum Y_lm h_lm.  The
+  /// transform of H* at frequency index k is the conjugate of the
+  /// transform of H at index (N-k)%N, so both terms come straight
+  /// from the transformed modes.
+  const unsigned int N = Modes.NTimes();
+  const unsigned int n = Modes.NFreq();
+  const unsigned int NM = Modes.NModes();
+  if(n != N/2+1) {
+    cerr << "Time and frequency data size mismatch: "
+         << n << "," << N/2+1 << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+
+  // The SWSHs at this point, in the inertial frame
+  vector<complex<double> > Ylm(NM);
+  {
+    SphericalFunctions::SWSH Y(Modes.SpinWeight());
+    Y.SetRotation(Quaternions::Quaternion(Vartheta, Varphi));
+    for(unsigned int i_m=0; i_m<NM; ++i_m) {
+      Ylm[i_m] = Y(Modes.LM(i_m)[0], Modes.LM(i_m)[1]);
+    }
+  }
+
+  const complex<double> c = std::polar(DetectorResponseAmp, DetectorResponsePhase);
+  vector<complex<double> > ComplexF(n, complex<double>(0.0, 0.0));
+  for(unsigned int i_m=0; i_m<NM; ++i_m) {
+    const complex<double>* H = Modes.Data(i_m);
+    const complex<double> cY = c * Ylm[i_m];
+    const complex<double> cYbar = std::conj(cY);
+    ComplexF[0] += cY*H[0] + cYbar*std::conj(H[0]);
+    for(unsigned int k=1; k<n; ++k) {
+      ComplexF[k] += cY*H[k] + cYbar*std::conj(H[N-k]);
+    }
   }
-  // Sort out some funky storage
-  mRealF.back() = 0.0; // RealT[1]; // just ignore data at the Nyquist frequency
+
+  // The transforms need to be multiplied by dt to correspond to the continuum FT
+  const double Scale = 0.5*Modes.DtDimensionful();
+  mRealF.resize(n);
+  mImagF.resize(n);
+  for(unsigned int i=0; i<n; ++i) {
+    mRealF[i] = Scale*ComplexF[i].real();
+    mImagF[i] = Scale*ComplexF[i].imag();
+  }
+  mRealF.back() = 0.0; // just ignore data at the Nyquist frequency
   mImagF.back() = 0.0;
   mImagF[0] = 0.0;
 }
@@ -248,21 +399,21 @@ namespace GWFrames {
       throw(GWFrames_VectorSizeMismatch);
     }
     // s1 s2* = (a1 + i b1) (a2 - i b2) = (a1 a2 + b1 b2) + i(b1 a2 - a1 b2)
-    WU::WrapVecDoub data(2*N);
+    vector<complex<double> > data(N, complex<double>(0.0, 0.0));
     for(unsigned int i=0; i<n; ++i) {
-      data.real(i) = (Re(i)*B.Re(i)+Im(i)*B.Im(i))*InversePSD[i];
-      data.imag(i) = (Im(i)*B.Re(i)-Re(i)*B.Im(i))*InversePSD[i];
+      data[i] = complex<double>((Re(i)*B.Re(i)+Im(i)*B.Im(i))*InversePSD[i],
+                                (Im(i)*B.Re(i)-Re(i)*B.Im(i))*InversePSD[i]);
     }
-    idft(data);
+    WU::idft(data);
     unsigned int maxi=0;
-    double maxmag = std::sqrt(sqr(data.real(0)) + sqr(data.imag(0)));
+    double maxmag = std::abs(data[0]);
     for(unsigned int i=1; i<N; ++i) {
-      const double mag = std::sqrt(sqr(data.real(i)) + sqr(data.imag(i)));
+      const double mag = std::abs(data[i]);
       if(mag>maxmag) { maxmag = mag; maxi = int(i); }
     }
     // note: assumes N is even and N >= maxi
     timeOffset = (maxi<N/2 ? double(maxi)/(N*df) : -double(N-maxi)/(N*df));
-    phaseOffset = atan2(data.imag(maxi), data.real(maxi))/2.0;
+    phaseOffset = std::arg(data[maxi])/2.0;
     /// The return from ifft is just the bare FFT sum, so we multiply by
     /// df to get the continuum-analog FT.  This is correct because the
     /// input data (re,im) are the continuum-analog data, rather than
@@ -301,4 +452,214 @@ namespace GWFrames {
     return Match(B, WU::InverseNoiseCurve(F(), Detector));
   }
 
+
+
+  /// Construct an empty bank of waveforms on the given frequency grid
+  MatchBank::MatchBank(const std::vector<double>& F, const std::vector<double>& InversePSD)
+    : mFreqs(F), mInversePSD(InversePSD), mData(), mNWaveforms(0)
+  {
+    /// \param[in] F Frequencies (in Hz) of every waveform to be added
+    /// \param[in] InversePSD Spectrum used to weight contributions by frequencies to matches
+    if(F.size()<2 || F.size() != InversePSD.size()) {
+      cerr << "\nF.size()=" << F.size() << "\tInversePSD.size()=" << InversePSD.size() << endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+  }
+
+  /// Construct an empty bank of waveforms on the given frequency grid
+  MatchBank::MatchBank(const std::vector<double>& F, const std::string& Detector)
+    : MatchBank(F, WU::InverseNoiseCurve(F, Detector))
+  {
+    /// \param[in] F Frequencies (in Hz) of every waveform to be added
+    /// \param[in] Detector Noise spectrum from this detector, which is evaluated just once
+  }
+
+  /// Copy a waveform into the bank, normalized with the bank's noise spectrum
+  unsigned int MatchBank::Add(const WaveformAtAPointFT& W)
+  {
+    /// \param[in] W Waveform to add, with the same frequencies as the bank
+    ///
+    /// Returns the index of the new waveform in the bank.
+    const vector<complex<double> > Data = Normalized(W);
+    mData.insert(mData.end(), Data.begin(), Data.end());
+    return mNWaveforms++;
+  }
+
+  /// Return the data of W, normalized with this bank's noise spectrum
+  vector<complex<double> > MatchBank::Normalized(const WaveformAtAPointFT& W) const
+  {
+    const unsigned int n = NFreq();
+    if(W.NFreq() != n) {
+      cerr << "\nW.NFreq()=" << W.NFreq() << "\tthis->NFreq()=" << n << endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+    const double df = F(1)-F(0);
+    const double rel_diff_df = std::fabs(1 - df/(W.F(1)-W.F(0)));
+    if(rel_diff_df > 1e-8) {
+      cerr << "Waveform frequency steps, " << df << " and " << W.F(1)-W.F(0)
+           << ", are not compatible with the MatchBank: rel_diff="<< rel_diff_df << endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+    const double snr = W.SNR(mInversePSD);
+    if(snr==0.0) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Waveform has zero SNR with the bank's noise spectrum;"
+           << " it cannot be normalized." << endl;
+      throw(GWFrames_ValueError);
+    }
+    vector<complex<double> > Data(n);
+    for(unsigned int i=0; i<n; ++i) {
+      Data[i] = complex<double>(W.Re(i), W.Im(i)) / snr;
+    }
+    return Data;
+  }
+
+  /// Maximize the overlap of normalized data A and B over time and phase offsets
+  void MatchBank::Match(const complex<double>* A, const complex<double>* B, vector<complex<double> >& Buffer,
+                        double& timeOffset, double& phaseOffset, double& match) const
+  {
+    /// This is the same calculation as WaveformAtAPointFT::Match,
+    /// using `Buffer` (of any size) as scratch space.
+    const unsigned int n = NFreq();
+    const unsigned int N = 2*(n-1);
+    const double df = F(1)-F(0);
+    Buffer.resize(N);
+    for(unsigned int i=0; i<n; ++i) {
+      Buffer[i] = A[i] * std::conj(B[i]) * mInversePSD[i];
+    }
+    std::fill(Buffer.begin()+n, Buffer.end(), complex<double>(0.0, 0.0));
+    WU::idft(Buffer);
+    unsigned int maxi=0;
+    double maxmag = std::abs(Buffer[0]);
+    for(unsigned int i=1; i<N; ++i) {
+      const double mag = std::abs(Buffer[i]);
+      if(mag>maxmag) { maxmag = mag; maxi = i; }
+    }
+    timeOffset = (maxi<N/2 ? double(maxi)/(N*df) : -double(N-maxi)/(N*df));
+    phaseOffset = std::arg(Buffer[maxi])/2.0;
+    match = 4.0*df*maxmag;
+  }
+
+  /// Compute the matches of one waveform with every waveform in the bank
+  std::vector<double> MatchBank::Matches(const WaveformAtAPointFT& A) const
+  {
+    /// \param[in] A Waveform to match against the bank
+    vector<double> timeOffsets, phaseOffsets, matches;
+    Matches(A, timeOffsets, phaseOffsets, matches);
+    return matches;
+  }
+
+  /// Compute the matches of one waveform with every waveform in the bank
+  void MatchBank::Matches(const WaveformAtAPointFT& A, std::vector<double>& timeOffsets,
+                          std::vector<double>& phaseOffsets, std::vector<double>& matches) const
+  {
+    /// \param[in] A Waveform to match against the bank
+    /// \param[out] timeOffsets Time offset (in seconds) between A and each waveform
+    /// \param[out] phaseOffsets Phase offset between A and each waveform
+    /// \param[out] matches Match between A and each waveform
+    ///
+    /// A is normalized with the bank's noise spectrum, whether or not
+    /// it was already normalized.  The waveforms are divided among
+    /// threads, each of which uses the same cached FFT plan.
+    const vector<complex<double> > Data = Normalized(A);
+    const unsigned int n = NFreq();
+    const int NW = mNWaveforms;
+    timeOffsets.resize(NW);
+    phaseOffsets.resize(NW);
+    matches.resize(NW);
+    int Error = 0;
+    #pragma omp parallel if(NW>1)
+    {
+      vector<complex<double> > Buffer;
+      #pragma omp for schedule(dynamic)
+      for(int j=0; j<NW; ++j) {
+        try {
+          Match(&Data[0], &mData[std::size_t(j)*n], Buffer, timeOffsets[j], phaseOffsets[j], matches[j]);
+        } catch(int thrown) {
+          #pragma omp critical(MatchBankError)
+          { Error = thrown; }
+        } catch(...) {
+          #pragma omp critical(MatchBankError)
+          { Error = GWFrames_FailedSystemCall; }
+        }
+      }
+    }
+    if(Error) { throw(Error); }
+  }
+
+  /// Compute the matches between every pair of waveforms in the bank
+  std::vector<std::vector<double> > MatchBank::MatchMatrix() const
+  {
+    /// The result is symmetric, with ones on the diagonal, so only
+    /// the pairs with i<j are computed.
+    const unsigned int n = NFreq();
+    const int NW = mNWaveforms;
+    vector<vector<double> > M(NW, vector<double>(NW, 1.0));
+    int Error = 0;
+    #pragma omp parallel if(NW>2)
+    {
+      vector<complex<double> > Buffer;
+      double timeOffset, phaseOffset;
+      #pragma omp for schedule(dynamic)
+      for(int i=0; i<NW; ++i) {
+        for(int j=i+1; j<NW; ++j) {
+          try {
+            Match(&mData[std::size_t(i)*n], &mData[std::size_t(j)*n], Buffer, timeOffset, phaseOffset, M[i][j]);
+          } catch(int thrown) {
+            #pragma omp critical(MatchBankError)
+            { Error = thrown; }
+          } catch(...) {
+            #pragma omp critical(MatchBankError)
+            { Error = GWFrames_FailedSystemCall; }
+          }
+          M[j][i] = M[i][j];
+        }
+      }
+    }
+    if(Error) { throw(Error); }
+    return M;
+  }
+
+  /// Compute the matches between every waveform in this bank and every waveform in B
+  std::vector<std::vector<double> > MatchBank::MatchMatrix(const MatchBank& B) const
+  {
+    /// \param[in] B Another bank, with the same frequencies and noise spectrum
+    ///
+    /// Element [i][j] of the result is the match between waveform i
+    /// of this bank and waveform j of B.
+    const unsigned int n = NFreq();
+    if(B.NFreq() != n || std::fabs(1 - (F(1)-F(0))/(B.F(1)-B.F(0))) > 1e-8) {
+      cerr << "\nThe frequencies of the banks are not compatible: NFreq()=" << n << "\tB.NFreq()=" << B.NFreq() << endl;
+      throw(GWFrames_VectorSizeMismatch);
+    }
+    for(unsigned int i=0; i<n; ++i) {
+      if(B.mInversePSD[i] != mInversePSD[i]) {
+        cerr << "\nThe noise spectra of the banks differ at index " << i << endl;
+        throw(GWFrames_VectorSizeMismatch);
+      }
+    }
+    const int NA = mNWaveforms, NB = B.mNWaveforms;
+    vector<vector<double> > M(NA, vector<double>(NB, 0.0));
+    int Error = 0;
+    #pragma omp parallel if(std::size_t(NA)*NB>1)
+    {
+      vector<complex<double> > Buffer;
+      double timeOffset, phaseOffset;
+      #pragma omp for schedule(dynamic)
+      for(int ij=0; ij<NA*NB; ++ij) {
+        const int i = ij/NB, j = ij%NB;
+        try {
+          Match(&mData[std::size_t(i)*n], &B.mData[std::size_t(j)*n], Buffer, timeOffset, phaseOffset, M[i][j]);
+        } catch(int thrown) {
+          #pragma omp critical(MatchBankError)
+          { Error = thrown; }
+        } catch(...) {
+          #pragma omp critical(MatchBankError)
+          { Error = GWFrames_FailedSystemCall; }
+        }
+      }
+    }
+    if(Error) { throw(Error); }
+    return M;
+  }
+
 }
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <complex>
 
 namespace GWFrames {
   class Waveform;
@@ -10,6 +11,44 @@ namespace GWFrames {
 
 namespace GWFrames {
 
+  /// The WaveformModesFT class holds the Fourier transforms of all
+  /// the modes of an inertial-frame waveform, so that
+  /// WaveformAtAPointFT objects for many points can be constructed by
+  /// combining the modes in the frequency domain.
+  class WaveformModesFT {
+  private:  // Member data
+    double mDt, mDt_dimensionful;
+    int mSpinWeight;
+    unsigned int mNTimes;
+    std::vector<std::vector<int> > mLM;
+    std::vector<double> mFreqs;
+    std::vector<std::complex<double> > mData; // Each mode occupies NTimes() consecutive elements
+
+  public:  // Constructors and Destructor
+    WaveformModesFT(const GWFrames::Waveform& W,
+                    const double Dt,
+                    const double TotalMass, // In solar masses
+                    const unsigned int WindowNCycles=1,
+                    const unsigned int ExtraZeroPadPowers=0);
+
+  public: // Access functions
+    /// Returns the positive physical frequencies in Hz
+    const std::vector<double>& F() const { return mFreqs; }
+    unsigned int NFreq() const { return mFreqs.size(); }
+    unsigned int NTimes() const { return mNTimes; }
+    unsigned int NModes() const { return mLM.size(); }
+    int SpinWeight() const { return mSpinWeight; }
+    double Dt() const { return mDt; }
+    double DtDimensionful() const { return mDt_dimensionful; }
+    const std::vector<std::vector<int> >& LM() const { return mLM; }
+    const std::vector<int>& LM(const unsigned int Mode) const { return mLM[Mode]; }
+    #ifndef SWIG
+    /// Returns the bare FFT sum of the (windowed) data of the given mode at all NTimes() frequencies
+    const std::complex<double>* Data(const unsigned int Mode) const { return &mData[std::size_t(Mode)*mNTimes]; }
+    #endif
+  }; // class
+
+
   /// The WaveformAtAPointFT class is a derived class, constructed
   /// from waveforms evaluated at a point, using the given complex
   /// detector response (F+ + i*Fx) -- or more particularly, its
@@ -30,6 +69,11 @@ namespace GWFrames {
                        const double DetectorResponseAmp=1.0,
                        const double DetectorResponsePhase=0.0,
                        const unsigned int ExtraZeroPadPowers=0);
+    WaveformAtAPointFT(const GWFrames::WaveformModesFT& Modes,
+                       const double Vartheta,
+                       const double Varphi,
+                       const double DetectorResponseAmp=1.0,
+                       const double DetectorResponsePhase=0.0);
 
   public: // Access functions
     /// Returns the physical frequencies in Hz
@@ -68,6 +112,43 @@ namespace GWFrames {
     WaveformAtAPointFT& ZeroAbove(const double Frequency);
   }; // class
 
+
+  /// The MatchBank class holds many WaveformAtAPointFT objects with
+  /// a common frequency grid and noise spectrum, and computes their
+  /// matches with each other or with other waveforms.
+  class MatchBank {
+  private:  // Member data
+    std::vector<double> mFreqs, mInversePSD;
+    std::vector<std::complex<double> > mData; // Normalized data; each waveform occupies NFreq() consecutive elements
+    unsigned int mNWaveforms;
+
+  public:  // Constructors and Destructor
+    MatchBank(const std::vector<double>& F, const std::vector<double>& InversePSD);
+    MatchBank(const std::vector<double>& F, const std::string& Detector="AdvLIGO_ZeroDet_HighP");
+
+  public: // Access functions
+    const std::vector<double>& F() const { return mFreqs; }
+    const double& F(const unsigned int f) const { return mFreqs[f]; }
+    unsigned int NFreq() const { return mFreqs.size(); }
+    unsigned int NWaveforms() const { return mNWaveforms; }
+    const std::vector<double>& InversePSD() const { return mInversePSD; }
+
+  public:  // Member functions
+    unsigned int Add(const WaveformAtAPointFT& W);
+    std::vector<double> Matches(const WaveformAtAPointFT& A) const;
+    #ifndef SWIG
+    void Matches(const WaveformAtAPointFT& A, std::vector<double>& timeOffsets,
+                 std::vector<double>& phaseOffsets, std::vector<double>& matches) const;
+    #endif
+    std::vector<std::vector<double> > MatchMatrix() const;
+    std::vector<std::vector<double> > MatchMatrix(const MatchBank& B) const;
+
+  private:
+    std::vector<std::complex<double> > Normalized(const WaveformAtAPointFT& W) const;
+    void Match(const std::complex<double>* A, const std::complex<double>* B, std::vector<std::complex<double> >& Buffer,
+               double& timeOffset, double& phaseOffset, double& match) const;
+  }; // class
+
 } // namespace GWFrames
 
 #endif // WAVEFORMATAPOINTFT_HPP
@@ -1,6 +1,12 @@
 #include "fft.hpp"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <cstdlib>
+#include <fftw3.h>
 #include "Utilities.hpp"
+#include "Errors.hpp"
 
 using namespace std;
 namespace WU = WaveformUtilities;
@@ -8,16 +14,12 @@ namespace WU = WaveformUtilities;
 vector<double> WU::TimeToFrequency(const vector<double>& Time) {
   /// This returns the double-sided frequency-space equivalent of a time vector
   const unsigned int N = Time.size();
-  if(N&(N-1)) {
-    cerr << "\nN=" << N << " is not a power of 2." << endl;
-    throw;
-  }
   const double df = 1.0 / (N*(Time[1]-Time[0]));
   vector<double> Freq(N, 0.0);
-  for(unsigned int i=0; i<N/2;  ++i) {
+  for(unsigned int i=0; i<(N+1)/2;  ++i) {
     Freq[i] = i*df;
   }
-  for(unsigned int i=N/2; i<N; ++i) {
+  for(unsigned int i=(N+1)/2; i<N; ++i) {
     Freq[i] = i*df - N*df;
   }
   return Freq;
@@ -26,10 +28,6 @@ vector<double> WU::TimeToFrequency(const vector<double>& Time) {
 vector<double> WU::TimeToPositiveFrequencies(const vector<double>& Time) {
   /// This returns the single-sided frequency-space equivalent of a time vector
   const unsigned int N = Time.size();
-  if(N&(N-1)) {
-    cerr << "\nN=" << N << " is not a power of 2." << endl;
-    throw;
-  }
   const unsigned int n = 1 + (N/2);
   const double df = 1.0 / (N*(Time[1]-Time[0]));
   vector<double> Freq(n, 0.0);
@@ -47,174 +45,256 @@ void WU::WrapVecDoub::validate() {
   }
 }
 
-void four1(vector<double>& data, const int isign);
+//// FFTW plans
+#ifndef DOXYGEN
+namespace {
+
+  enum TransformKind { Forward, Backward, RealToComplex, ComplexToReal };
+
+  // The plans, which are destroyed (after saving any new wisdom) at exit
+  struct PlanCache {
+    std::map<std::tuple<int, unsigned int, bool, bool>, fftw_plan> Plans;
+    std::string WisdomFile;
+    bool NewWisdom;
+    PlanCache() : Plans(), WisdomFile(), NewWisdom(false) { }
+    ~PlanCache() {
+      if(NewWisdom && !WisdomFile.empty()) {
+        fftw_export_wisdom_to_filename(WisdomFile.c_str());
+      }
+      for(std::map<std::tuple<int, unsigned int, bool, bool>, fftw_plan>::iterator it=Plans.begin(); it!=Plans.end(); ++it) {
+        fftw_destroy_plan(it->second);
+      }
+    }
+  };
+
+  // FFTW's planner is made thread safe (see MakeFFTWPlannerThreadSafe)
+  // so that other code planning its own transforms, like spinsfast,
+  // can do so at the same time; the plan cache and wisdom settings
+  // are only touched while holding this
+  std::mutex PlannerMutex;
+  PlanCache Cache;
+  bool WisdomInitialized = false;
+  unsigned int PlannerFlags = FFTW_ESTIMATE;
+
+  // Must be called with PlannerMutex held
+  void InitializeWisdom() {
+    if(WisdomInitialized) { return; }
+    WisdomInitialized = true;
+    const char* FileName = std::getenv("GWFRAMES_FFTW_WISDOM");
+    if(FileName && *FileName) {
+      Cache.WisdomFile = FileName;
+      fftw_import_wisdom_from_filename(FileName);
+      PlannerFlags = FFTW_MEASURE;
+    }
+  }
+
+  // Return the cached plan for this kind and length of transform,
+  // making it if necessary.  The plan is made on scratch arrays, so
+  // that planning does not overwrite the data; it may then be
+  // executed on any arrays with the same alignment and placement as
+  // `in` and `out`.
+  fftw_plan Plan(const TransformKind Kind, const unsigned int n, double* in, double* out) {
+    const bool InPlace = (in==out);
+    const bool Aligned = (fftw_alignment_of(in)==0 && fftw_alignment_of(out)==0);
+    const std::tuple<int, unsigned int, bool, bool> Key(Kind, n, InPlace, Aligned);
+    WU::MakeFFTWPlannerThreadSafe();
+    std::lock_guard<std::mutex> Lock(PlannerMutex);
+    InitializeWisdom();
+    std::map<std::tuple<int, unsigned int, bool, bool>, fftw_plan>::const_iterator it = Cache.Plans.find(Key);
+    if(it!=Cache.Plans.end()) { return it->second; }
+    const std::size_t NComplex = (Kind==Forward || Kind==Backward ? n : n/2+1);
+    double* a = static_cast<double*>(fftw_malloc(2*NComplex*sizeof(double)));
+    double* b = (InPlace ? a : static_cast<double*>(fftw_malloc(2*NComplex*sizeof(double))));
+    const unsigned int Flags = PlannerFlags | (Aligned ? 0 : FFTW_UNALIGNED);
+    fftw_plan p = 0;
+    switch(Kind) {
+    case Forward:
+      p = fftw_plan_dft_1d(n, reinterpret_cast<fftw_complex*>(a), reinterpret_cast<fftw_complex*>(b), FFTW_FORWARD, Flags);
+      break;
+    case Backward:
+      p = fftw_plan_dft_1d(n, reinterpret_cast<fftw_complex*>(a), reinterpret_cast<fftw_complex*>(b), FFTW_BACKWARD, Flags);
+      break;
+    case RealToComplex:
+      p = fftw_plan_dft_r2c_1d(n, a, reinterpret_cast<fftw_complex*>(b), Flags);
+      break;
+    case ComplexToReal:
+      p = fftw_plan_dft_c2r_1d(n, reinterpret_cast<fftw_complex*>(a), b, Flags);
+      break;
+    }
+    if(b!=a) { fftw_free(b); }
+    fftw_free(a);
+    if(!p) {
+      cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": FFTW failed to make a plan of kind " << Kind << " and length " << n << "." << endl;
+      throw(GWFrames_FailedSystemCall);
+    }
+    Cache.Plans[Key] = p;
+    Cache.NewWisdom = true;
+    return p;
+  }
+
+  void ComplexTransform(const TransformKind Kind, std::complex<double>* data, const unsigned int n) {
+    if(n==0) { return; }
+    double* d = reinterpret_cast<double*>(data);
+    fftw_execute_dft(Plan(Kind, n, d, d), reinterpret_cast<fftw_complex*>(d), reinterpret_cast<fftw_complex*>(d));
+  }
+
+}
+#endif // DOXYGEN
+
+void WU::MakeFFTWPlannerThreadSafe() {
+  /// FFTW's planner is not thread safe by default.  This makes it so
+  /// for every caller in the process (including spinsfast), and need
+  /// only be called before the first plan is made in any thread; it
+  /// is safe to call more than once.
+  static std::once_flag Once;
+  std::call_once(Once, fftw_make_planner_thread_safe);
+}
+
+bool WU::SetFFTWisdomFile(const std::string& FileName) {
+  /// \param FileName File from which to read and to which to write wisdom
+  ///
+  /// Plans made after this is called use `FFTW_MEASURE`, which is
+  /// slow the first time each length is planned.  New wisdom is
+  /// written to the file by `SaveFFTWisdom`, or automatically at
+  /// exit, so that later runs reuse the result.  Setting the
+  /// environment variable `GWFRAMES_FFTW_WISDOM` to a file name has
+  /// the same effect.  Returns true if wisdom was read from the file.
+  std::lock_guard<std::mutex> Lock(PlannerMutex);
+  WisdomInitialized = true;
+  Cache.WisdomFile = FileName;
+  PlannerFlags = FFTW_MEASURE;
+  return fftw_import_wisdom_from_filename(FileName.c_str());
+}
+
+bool WU::SaveFFTWisdom() {
+  /// Write all wisdom accumulated so far to the file given to
+  /// `SetFFTWisdomFile` (or by `GWFRAMES_FFTW_WISDOM`).  Returns
+  /// true on success, and false if the write failed or no file was
+  /// given.
+  std::lock_guard<std::mutex> Lock(PlannerMutex);
+  if(Cache.WisdomFile.empty()) { return false; }
+  Cache.NewWisdom = false;
+  return fftw_export_wisdom_to_filename(Cache.WisdomFile.c_str());
+}
+
+unsigned int WU::NextFastFFTSize(const unsigned int N) {
+  /// Returns the smallest number at least N (and at least 2) of the
+  /// form \f$2^a 3^b 5^c 7^d\f$ with \f$a \geq 1\f$, for which FFTW
+  /// is fast.
+  for(unsigned int n=std::max(N+(N%2), 2u); ; n+=2) {
+    unsigned int m = n/2;
+    const unsigned int Primes[4] = {2, 3, 5, 7};
+    for(unsigned int i=0; i<4; ++i) {
+      while(m%Primes[i]==0) { m /= Primes[i]; }
+    }
+    if(m==1) { return n; }
+  }
+}
 
 void WU::dft(vector<double>& data) {
-  four1(data, -1);
-  return;
+  if(data.size()%2) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Interleaved complex data must have even size, not " << data.size() << "." << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  ComplexTransform(Forward, reinterpret_cast<complex<double>*>(data.data()), data.size()/2);
 }
 
 void WU::idft(vector<double>& data) {
-  four1(data, 1);
-  return;
+  if(data.size()%2) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Interleaved complex data must have even size, not " << data.size() << "." << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  ComplexTransform(Backward, reinterpret_cast<complex<double>*>(data.data()), data.size()/2);
 }
 
-void realft(vector<double> &Data, const int isign);
+void WU::dft(vector<complex<double> >& data) {
+  ComplexTransform(Forward, data.data(), data.size());
+}
 
-void  WU::realdft(std::vector<double>& data) {
-  realft(data, 1);
-  for(unsigned int i=3; i<data.size(); ++i) {
-    data[i++] *= -1.0;
-  }
-  return;
+void WU::idft(vector<complex<double> >& data) {
+  ComplexTransform(Backward, data.data(), data.size());
 }
 
+vector<complex<double> > WU::rdft(const vector<double>& data) {
+  /// Returns the N/2+1 values of the transform at non-negative
+  /// frequencies; the rest are their complex conjugates.
+  const unsigned int n = data.size();
+  vector<complex<double> > Transform(n/2+1);
+  if(n==0) { return vector<complex<double> >(0); }
+  vector<double> In(data); // FFTW takes a non-const pointer
+  double* out = reinterpret_cast<double*>(Transform.data());
+  fftw_execute_dft_r2c(Plan(RealToComplex, n, In.data(), out), In.data(), reinterpret_cast<fftw_complex*>(out));
+  return Transform;
+}
 
-//// Numerical Recipes routines
-template<class T>
-inline void SWAP(T &a, T &b) {T dum=a; a=b; b=dum;}
-template<class T>
-inline T SQR(const T a) {return a*a;}
+vector<double> WU::irdft(const vector<complex<double> >& data, const unsigned int N) {
+  /// \param data Values at the N/2+1 non-negative frequencies
+  /// \param N Length of the real result
+  if(data.size()!=N/2+1) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": data.size()=" << data.size() << " should be N/2+1 for N=" << N << "." << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  vector<double> Out(N);
+  if(N==0) { return Out; }
+  vector<complex<double> > In(data); // The complex-to-real transform destroys its input
+  double* in = reinterpret_cast<double*>(In.data());
+  fftw_execute_dft_c2r(Plan(ComplexToReal, N, in, Out.data()), reinterpret_cast<fftw_complex*>(in), Out.data());
+  return Out;
+}
 
-void four1(double *data, const int n, const int isign) {
-  int nn,mmax,m,j,istep,i;
-  double wtemp,wr,wpr,wpi,wi,theta,tempr,tempi;
-  if (n<2 || n&(n-1)) {
-    cerr << "n must be power of 2 in four1" << endl;
-    throw;
+void WU::realdft(vector<double>& data) {
+  /// On output, data[0] and data[1] hold the (real) values at zero
+  /// and the Nyquist frequency, and data[2k] and data[2k+1] hold the
+  /// real and imaginary parts at frequency k, for 0<k<N/2.
+  const unsigned int n = data.size();
+  if(n%2) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": realdft requires even size, not " << n << "." << endl;
+    throw(GWFrames_VectorSizeMismatch);
   }
-  nn = n << 1;
-  j = 1;
-  for (i=1;i<nn;i+=2) {
-    if (j > i) {
-      SWAP(data[j-1],data[i-1]);
-      SWAP(data[j],data[i]);
-    }
-    m=n;
-    while (m >= 2 && j > m) {
-      j -= m;
-      m >>= 1;
-    }
-    j += m;
-  }
-  mmax=2;
-  while (nn > mmax) {
-    istep=mmax << 1;
-    theta=isign*(6.28318530717959/mmax);
-    wtemp=sin(0.5*theta);
-    wpr = -2.0*wtemp*wtemp;
-    wpi=sin(theta);
-    wr=1.0;
-    wi=0.0;
-    for (m=1;m<mmax;m+=2) {
-      for (i=m;i<=nn;i+=istep) {
-	j=i+mmax;
-	tempr=wr*data[j-1]-wi*data[j];
-	tempi=wr*data[j]+wi*data[j-1];
-	data[j-1]=data[i-1]-tempr;
-	data[j]=data[i]-tempi;
-	data[i-1] += tempr;
-	data[i] += tempi;
-      }
-      wr=(wtemp=wr)*wpr-wi*wpi+wr;
-      wi=wi*wpr+wtemp*wpi+wi;
-    }
-    mmax=istep;
+  if(n==0) { return; }
+  const vector<complex<double> > Transform = rdft(data);
+  data[0] = Transform[0].real();
+  data[1] = Transform[n/2].real();
+  for(unsigned int k=1; k<n/2; ++k) {
+    data[2*k] = Transform[k].real();
+    data[2*k+1] = Transform[k].imag();
   }
 }
-void four1(vector<double> &data, const int isign) {
-  four1(&data[0],data.size()/2,isign);
-}
 
-void realft(vector<double> &data, const int isign) {
-  int i,i1,i2,i3,i4,n=data.size();
-  double c1=0.5,c2,h1r,h1i,h2r,h2i,wr,wi,wpr,wpi,wtemp;
-  double theta=3.141592653589793238/double(n>>1);
-  if (isign == 1) {
-    c2 = -0.5;
-    four1(data,1);
-  } else {
-    c2=0.5;
-    theta = -theta;
-  }
-  wtemp=sin(0.5*theta);
-  wpr = -2.0*wtemp*wtemp;
-  wpi=sin(theta);
-  wr=1.0+wpr;
-  wi=wpi;
-  for (i=1;i<(n>>2);i++) {
-    i2=1+(i1=i+i);
-    i4=1+(i3=n-i1);
-    h1r=c1*(data[i1]+data[i3]);
-    h1i=c1*(data[i2]-data[i4]);
-    h2r= -c2*(data[i2]+data[i4]);
-    h2i=c2*(data[i1]-data[i3]);
-    data[i1]=h1r+wr*h2r-wi*h2i;
-    data[i2]=h1i+wr*h2i+wi*h2r;
-    data[i3]=h1r-wr*h2r+wi*h2i;
-    data[i4]= -h1i+wr*h2i+wi*h2r;
-    wr=(wtemp=wr)*wpr-wi*wpi+wr;
-    wi=wi*wpr+wtemp*wpi+wi;
-  }
-  if (isign == 1) {
-    data[0] = (h1r=data[0])+data[1];
-    data[1] = h1r-data[1];
-  } else {
-    data[0]=c1*((h1r=data[0])+data[1]);
-    data[1]=c1*(h1r-data[1]);
-    four1(data,-1);
-  }
-}
-
-void convlv(const vector<double> &data, const vector<double> &respns, const int isign, vector<double> &ans) {
-  int i,no2,n=data.size(),m=respns.size();
-  double mag2,tmp;
-  vector<double> temp(n);
-  temp[0]=respns[0];
-  for (i=1;i<(m+1)/2;i++) {
-    temp[i]=respns[i];
-    temp[n-i]=respns[m-i];
-  }
-  for (i=(m+1)/2;i<n-(m-1)/2;i++)
-    temp[i]=0.0;
-  for (i=0;i<n;i++)
-    ans[i]=data[i];
-  realft(ans,1);
-  realft(temp,1);
-  no2=n>>1;
-  if (isign == 1) {
-    for (i=2;i<n;i+=2) {
-      tmp=ans[i];
-      ans[i]=(ans[i]*temp[i]-ans[i+1]*temp[i+1])/no2;
-      ans[i+1]=(ans[i+1]*temp[i]+tmp*temp[i+1])/no2;
+vector<double> WU::convlv(const vector<double>& data, const vector<double>& respns, const int isign) {
+  /// \param data Periodic data of length N
+  /// \param respns Response of odd length M<=N, in wrap-around order
+  /// \param isign 1 to convolve; -1 to deconvolve
+  ///
+  /// This has the same conventions as Numerical Recipes' `convlv`.
+  const unsigned int n = data.size(), m = respns.size();
+  if(m==0 || m>n) {
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": respns.size()=" << m << " must be in [1, data.size()=" << n << "]." << endl;
+    throw(GWFrames_VectorSizeMismatch);
+  }
+  vector<double> temp(n, 0.0);
+  temp[0] = respns[0];
+  for(unsigned int i=1; i<(m+1)/2; ++i) {
+    temp[i] = respns[i];
+    temp[n-i] = respns[m-i];
+  }
+  vector<complex<double> > ans = rdft(data);
+  const vector<complex<double> > resp = rdft(temp);
+  if(isign == 1) {
+    for(unsigned int i=0; i<ans.size(); ++i) {
+      ans[i] *= resp[i]/double(n);
     }
-    ans[0]=ans[0]*temp[0]/no2;
-    ans[1]=ans[1]*temp[1]/no2;
-  } else if (isign == -1) {
-    for (i=2;i<n;i+=2) {
-      if ((mag2=SQR(temp[i])+SQR(temp[i+1])) == 0.0) {
-        cerr << "Deconvolving at response zero in convlv" << endl;
-        throw;
+  } else if(isign == -1) {
+    for(unsigned int i=0; i<ans.size(); ++i) {
+      if(resp[i] == 0.0) {
+        cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": Deconvolving at response zero in convlv" << endl;
+        throw(GWFrames_ValueError);
       }
-      tmp=ans[i];
-      ans[i]=(ans[i]*temp[i]+ans[i+1]*temp[i+1])/mag2/no2;
-      ans[i+1]=(ans[i+1]*temp[i]-tmp*temp[i+1])/mag2/no2;
-    }
-    if (temp[0] == 0.0 || temp[1] == 0.0) {
-      cerr << "Deconvolving at response zero in convlv" << endl;
-      throw;
+      ans[i] /= resp[i]*double(n);
     }
-    ans[0]=ans[0]/temp[0]/no2;
-    ans[1]=ans[1]/temp[1]/no2;
   } else {
-    cerr << "No meaning for isign in convlv" << endl;
-    throw;
+    cerr << "\n\n" << __FILE__ << ":" << __LINE__ << ": No meaning for isign=" << isign << " in convlv" << endl;
+    throw(GWFrames_ValueError);
   }
-  realft(ans,-1);
-}
-
-vector<double> convlv(const vector<double>& data, const vector<double>& respns, const int isign) {
-  vector<double> ans(data.size());
-  convlv(data, respns, isign, ans);
-  return ans;
+  return irdft(ans, n);
 }
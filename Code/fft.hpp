@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <complex>
+#include <string>
 
 namespace WaveformUtilities {
   
@@ -28,13 +29,31 @@ namespace WaveformUtilities {
   /// This function returns the positive half of the frequencies, so returned size is 1/2 input size + 1
   std::vector<double> TimeToPositiveFrequencies(const std::vector<double>& Time);
   
-  /// The following call the Numerical Recipes fft routines (from fourier.h)
-  /// Note that the returned quantities represent the bare fft sum, with no normalization constants
+  /// The following call FFTW, with plans cached for each length and shared among threads.
+  /// Note that the returned quantities represent the bare fft sum, with no normalization constants.
+  /// The vector<double> versions hold complex data as interleaved real and imaginary parts, and
+  /// `realdft` uses the packed format of Numerical Recipes' `realft` (with the sign of `dft`).
   void dft(std::vector<double>& data);
   void idft(std::vector<double>& data);
   void realdft(std::vector<double>& data);
+  void dft(std::vector<std::complex<double> >& data);
+  void idft(std::vector<std::complex<double> >& data);
+  std::vector<std::complex<double> > rdft(const std::vector<double>& data);
+  std::vector<double> irdft(const std::vector<std::complex<double> >& data, const unsigned int N);
   std::vector<double> convlv(const std::vector<double>& data, const std::vector<double>& respns, const int isign);
-  
+
+  /// Smallest even length at least N for which FFTs are fast
+  unsigned int NextFastFFTSize(const unsigned int N);
+
+  /// Read FFTW wisdom from this file (if it exists), plan carefully, and save new wisdom there
+  bool SetFFTWisdomFile(const std::string& FileName);
+
+  /// Write the wisdom accumulated so far to the file given to SetFFTWisdomFile
+  bool SaveFFTWisdom();
+
+  /// Allow FFTW plans to be made from several threads at once
+  void MakeFFTWPlannerThreadSafe();
+
 }
 
 #endif // FFT_HPP
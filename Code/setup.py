@@ -119,6 +119,22 @@ if "FFTW3_HOME" in environ :
     IncDirs += [environ["FFTW3_HOME"]+'/include']
     LibDirs += [environ["FFTW3_HOME"]+'/lib']
 
+## Use OpenMP for the time-parallel loops, unless GWFRAMES_NO_OPENMP is
+## set (e.g., for compilers without OpenMP support)
+OpenMPFlags = ['-fopenmp']
+if "GWFRAMES_NO_OPENMP" in environ :
+    OpenMPFlags = []
+
+## Use an optimized CBLAS for the dense complex matrix products, in
+## place of GSL's reference CBLAS.  GWFRAMES_BLAS is a space-separated
+## list of library names, without `-l` (e.g., GWFRAMES_BLAS=openblas),
+## as for the Makefile.
+BLASLibraries = ['gslcblas']
+BLASFlags = []
+if "GWFRAMES_BLAS" in environ :
+    BLASLibraries = environ["GWFRAMES_BLAS"].split()
+    BLASFlags = ['-DUSE_CBLAS']
+
 # If /opt/local directories exist, use them
 if isdir('/opt/local/include'):
     IncDirs += ['/opt/local/include']
@@ -228,14 +244,14 @@ setup(name="GWFrames",
                              'GWFrames_Doc.i'],
                   include_dirs=IncDirs,
                   library_dirs=LibDirs,
-                  libraries=['gsl', 'gslcblas', 'fftw3'],
+                  libraries=['gsl'] + BLASLibraries + ['fftw3_threads', 'fftw3'],
                   define_macros = [('CodeRevision', CodeRevision)],
                   language='c++',
                   swig_opts=swig_opts,
                   extra_objects = glob.glob('spinsfast/build/temp/*/*.o'),
-                  extra_link_args = ['-fPIC',],
+                  extra_link_args = ['-fPIC',] + OpenMPFlags,
                   # extra_link_args=['-Wl,-undefined,error'], # `-undefined,error` is not defined on some platforms...
-                  extra_compile_args=['-Wno-deprecated', '-Wno-unused-variable', '-DUSE_GSL', '-O3', '-ffast-math', '-ftree-vectorize'],
+                  extra_compile_args=['-Wno-deprecated', '-Wno-unused-variable', '-DUSE_GSL', '-O3', '-ffast-math', '-ftree-vectorize'] + OpenMPFlags + BLASFlags,
                   ),
         ],
       # classifiers = ,
@@ -0,0 +1,71 @@
+"""Compare `AlignWaveformsBatch` with `AlignWaveforms` on each pair.
+
+A precessing PN waveform is copied several times, with each copy
+offset in time and rotated by a different amount.  The pairs are
+aligned together by `AlignWaveformsBatch`, and one at a time by
+`AlignWaveforms`; the largest differences between the aligned
+Waveforms are printed.  One pair has an alignment interval beyond the
+end of the data, and must fail in both cases without affecting the
+others:
+
+    python AlignWaveformsBatch.py
+
+"""
+from __future__ import division, print_function
+import numpy as np
+import Quaternions
+import GWFrames
+
+W = GWFrames.PNWaveform('TaylorT4', 0.0, [0.1, 0.2, 0.3], [-0.2, 0.1, 0.0], 0.01)
+W = GWFrames.Waveform(W).TransformToInertialFrame().TransformToCorotatingFrame()
+t_1 = W.T(0) + 0.3*(W.T(W.NTimes()-1)-W.T(0))
+t_2 = t_1 + 1000.
+Tolerance = 1e-8
+
+def RotorAngle(q):
+    return 2*np.arccos(min(1.0, abs(q[0])))
+
+Offsets = [(-25.3, [0.05, 0.02, 0.03]), (12.1, [-0.01, 0.04, 0.0]), (3.7, [0.0, 0.0, 0.2]), (0.0, [0.1, -0.1, 0.05])]
+As, Bs, t_1s, t_2s = [], [], [], []
+for time_offset,axis in Offsets:
+    W_B = GWFrames.Waveform(W)
+    W_B.SetTime(W_B.T()+time_offset)
+    W_B.SetFrame(Quaternions.exp(Quaternions.Quaternion(0, *axis))*W_B.Frame())
+    As.append(GWFrames.Waveform(W))
+    Bs.append(W_B)
+    t_1s.append(t_1)
+    t_2s.append(t_2)
+Failing = 2
+t_2s[Failing] = W.T(W.NTimes()-1) + 100.
+
+Statistics, AlignedAs, AlignedBs = GWFrames.AlignWaveformsBatch(As, Bs, t_1s, t_2s)
+assert len(Statistics)==len(AlignedAs)==len(AlignedBs)==len(Offsets)
+assert all(isinstance(w, GWFrames.Waveform) for w in AlignedAs+AlignedBs)
+
+Failures = 0
+for i in range(len(Offsets)):
+    W_A, W_B = GWFrames.Waveform(As[i]), GWFrames.Waveform(Bs[i])
+    try:
+        GWFrames.AlignWaveforms(W_A, W_B, t_1s[i], t_2s[i])
+        PairwiseFailed = False
+    except Exception:
+        PairwiseFailed = True
+    if i==Failing:
+        print("Pair {0}: batch Error={1}, pairwise failed={2}".format(i, Statistics[i].Error, PairwiseFailed))
+        if Statistics[i].Error==0 or not PairwiseFailed:
+            Failures += 1
+        continue
+    Differences = [np.max(np.abs(np.asarray(a)-np.asarray(b))) for a,b in
+                   [(AlignedAs[i].T(), W_A.T()), (AlignedBs[i].T(), W_B.T()),
+                    (AlignedAs[i].Data(), W_A.Data()), (AlignedBs[i].Data(), W_B.Data()),
+                    ([RotorAngle(a*b.inverse()) for a,b in zip(AlignedBs[i].Frame(), W_B.Frame())], 0.0)]]
+    print("Pair {0}: batch Error={1}, largest difference {2:.3e}".format(i, Statistics[i].Error, max(Differences)))
+    if PairwiseFailed or Statistics[i].Error!=0 or max(Differences)>Tolerance:
+        Failures += 1
+
+# The inputs must not have been changed
+for B,(time_offset,axis) in zip(Bs, Offsets):
+    if abs(B.T(0)-W.T(0)-time_offset)>1e-12:
+        Failures += 1
+
+assert Failures==0
@@ -0,0 +1,42 @@
+"""Compare the FFT-correlation scan in `AlignWaveforms` with the exact scan.
+
+A precessing PN waveform is copied, and the copy is offset in time
+and rotated.  The pair is then aligned twice, with `FFTScan=False`
+(integrating at each deltat) and with `FFTScan=True` (all deltat at
+once by cross-correlation).  The differences between the two results
+in deltat and in the rotor R_delta are printed, along with the
+errors relative to the known offsets and the time spent on each scan:
+
+    python AlignmentFFTScan.py
+
+"""
+from __future__ import division, print_function
+import numpy as np
+import Quaternions
+import GWFrames
+
+W = GWFrames.PNWaveform('TaylorT4', 0.0, [0.1, 0.2, 0.3], [-0.2, 0.1, 0.0], 0.01)
+W = GWFrames.Waveform(W).TransformToInertialFrame().TransformToCorotatingFrame()
+time_offset = -25.3
+R = Quaternions.exp(Quaternions.Quaternion(0, 0.05, 0.02, 0.03))
+t_1 = W.T(0) + 0.3*(W.T(W.NTimes()-1)-W.T(0))
+t_2 = t_1 + 1000.
+
+def RotorAngle(q):
+    return 2*np.arccos(min(1.0, abs(q[0])))
+
+Results = {}
+for FFTScan in [False, True]:
+    W_A, W_B = GWFrames.Waveform(W), GWFrames.Waveform(W)
+    W_B.SetTime(W_B.T()+time_offset)
+    W_B.SetFrame(R*W_B.Frame())
+    Statistics = GWFrames.AlignWaveforms(W_A, W_B, t_1, t_2, 0, [], False, False, FFTScan)
+    i_mid = np.argmin(np.abs(W_B.T()-(t_1+t_2)/2.))
+    Results[FFTScan] = (W_B.T(0), W_B.Frame(i_mid))
+    print("FFTScan={0}: deltat error {1:.3e}, R_delta error {2:.3e}, scan took {3:.3f} s".format(
+        FFTScan, W_B.T(0)-W_A.T(0), RotorAngle(W_B.Frame(i_mid)*W_A.Frame(i_mid).inverse()), Statistics.ScanTime))
+
+DeltatDifference = Results[True][0]-Results[False][0]
+RotorDifference = RotorAngle(Results[True][1]*Results[False][1].inverse())
+print("Difference between scans: deltat {0:.3e}, R_delta {1:.3e} rad".format(DeltatDifference, RotorDifference))
+assert abs(DeltatDifference)<1e-3 and RotorDifference<1e-5
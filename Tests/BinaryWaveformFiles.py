@@ -0,0 +1,77 @@
+"""Check that binary Waveform files round trip, and that damaged files are rejected.
+
+A random Waveform is written with `OutputBinary` and read back.  Then
+truncated copies of the file, and copies with corrupt headers
+(including counts whose products overflow, and misaligned offsets),
+are each read, and must
+raise an exception rather than crash:
+
+    python BinaryWaveformFiles.py
+
+"""
+from __future__ import division, print_function
+import os
+import struct
+import tempfile
+import numpy as np
+import Quaternions
+import GWFrames
+
+np.random.seed(1234)
+T = np.linspace(0., 100., num=1000)
+LM = [[l,m] for l in range(2,5) for m in range(-l,l+1)]
+Data = np.random.normal(size=(len(LM), len(T))) + 1j*np.random.normal(size=(len(LM), len(T)))
+W = GWFrames.Waveform(T, LM, Data)
+W.SetFrame([Quaternions.Quaternion(np.cos(0.01*t), 0., 0., np.sin(0.01*t)) for t in T])
+
+Directory = tempfile.mkdtemp()
+FileName = os.path.join(Directory, 'W.bin')
+W.OutputBinary(FileName)
+W2 = GWFrames.Waveform(FileName, "Binary")
+assert np.array_equal(W.T(), W2.T()) and np.array_equal(W.LM(), W2.LM()) and np.array_equal(W.Data(), W2.Data())
+print("Round trip: OK")
+
+with open(FileName, 'rb') as f:
+    Original = f.read()
+
+# Offsets of the uint64 fields of the header
+Fields = ['NModes', 'NTimes', 'NFrame', 'HistoryLength', 'LMOffset', 'HistoryOffset',
+          'TimeOffset', 'FrameOffset', 'DataOffset', 'FileSize']
+Offset = dict((Name, 40+8*i) for i,Name in enumerate(Fields))
+
+def Corrupt(**Values):
+    Bytes = bytearray(Original)
+    for Name,Value in Values.items():
+        struct.pack_into('=Q', Bytes, Offset[Name], Value)
+    return bytes(Bytes)
+
+def Field(Name):
+    return struct.unpack_from('=Q', Original, Offset[Name])[0]
+
+Damaged = [
+    ('Truncated header', Original[:64]),
+    ('Truncated data', Original[:len(Original)//2]),
+    ('Truncated data, with FileSize fixed', Corrupt(FileSize=len(Original)//2)[:len(Original)//2]),
+    ('LM block overlaps history', Corrupt(NModes=10**6)),
+    ('History overlaps times', Corrupt(HistoryLength=10**6)),
+    ('Times overlap frame', Corrupt(NTimes=len(T)+100)),
+    ('Frame overlaps data', Corrupt(NFrame=len(T)+100)),
+    ('Offsets out of order', Corrupt(TimeOffset=2**40, FrameOffset=2**40+64)),
+    ('NModes*NTimes overflows', Corrupt(NModes=2**33, NTimes=2**31)),
+    ('NTimes*16 overflows', Corrupt(NTimes=2**60+1)),
+    # Everything fits inside the (extended) file, but the data block is misaligned
+    ('Misaligned data block', Corrupt(DataOffset=Field('DataOffset')+4, FileSize=len(Original)+16)+b'\0'*16),
+]
+Failures = 0
+for Label,Bytes in Damaged:
+    with open(FileName, 'wb') as f:
+        f.write(Bytes)
+    try:
+        GWFrames.Waveform(FileName, "Binary")
+        print("{0}: FAILED (no exception)".format(Label))
+        Failures += 1
+    except Exception:
+        print("{0}: rejected".format(Label))
+os.remove(FileName)
+os.rmdir(Directory)
+assert Failures==0
@@ -0,0 +1,45 @@
+"""Round trip Waveforms through `OutputToCompressedH5` and `ReadFromCompressedH5`.
+
+An analytic chirp-like waveform is written at several tolerances and
+read back at its original times and in its original frame.  The
+maximum error (summed in quadrature over modes) relative to the peak
+norm is printed along with the file size, and must be close to the
+requested tolerance:
+
+    python CompressedH5.py [NTimes]
+
+"""
+from __future__ import division, print_function
+import os
+import sys
+import tempfile
+import numpy as np
+import GWFrames
+
+NTimes = int(sys.argv[1]) if len(sys.argv)>1 else 20000
+
+LM = [[l,m] for l in range(2,5) for m in range(-l,l+1)]
+T = np.linspace(0., 4000., num=NTimes)
+Phase = 0.05*T + 1.e-5*T**2
+Data = np.array([(1.0+0.1*l)*np.exp(1j*(m*Phase+0.1*l)) * (1.0+1.e-4*T) / (1.0+abs(m-2)) for l,m in LM])
+W = GWFrames.Waveform(T, LM, Data)
+W.SetFrameType(GWFrames.Inertial)
+W.SetDataType(GWFrames.h)
+PeakNorm = np.max(np.sqrt(np.sum(np.abs(W.Data())**2, axis=0)))
+
+Directory = tempfile.mkdtemp()
+Failures = []
+for Tolerance in [1e-4, 1e-6, 1e-8]:
+    FileName = os.path.join(Directory, 'W.h5')
+    W.OutputToCompressedH5(FileName, Tolerance)
+    FileName = os.path.join(Directory, W.GetFileNamePrefix()+'W.h5')
+    W2 = GWFrames.ReadFromCompressedH5(FileName)
+    assert np.array_equal(W2.T(), W.T()) and np.array_equal(W2.LM(), W.LM())
+    assert W2.FrameType()==W.FrameType()
+    Error = np.max(np.sqrt(np.sum(np.abs(W2.Data()-W.Data())**2, axis=0))) / PeakNorm
+    print("Tolerance={0:.0e}: relative error {1:.3e}, {2} bytes".format(Tolerance, Error, os.path.getsize(FileName)))
+    if Error>2*Tolerance:
+        Failures.append(Tolerance)
+    os.remove(FileName)
+os.rmdir(Directory)
+assert not Failures, "Errors too large at tolerances {0}".format(Failures)
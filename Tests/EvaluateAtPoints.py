@@ -0,0 +1,70 @@
+"""Compare `Waveform.EvaluateAtPoints` with looped `EvaluateAtPoint`.
+
+A random Waveform is evaluated at many points at once, and at each
+point separately, with (a) no frame data, (b) a constant frame, (c) a
+time-dependent frame, and (d) a time-dependent frame with some modes
+missing, so that `EvaluateAtPoints` falls back to evaluating each
+point separately.  Each case is also evaluated on a subset of time
+indices.  There are more time steps than one chunk of the matrix
+product, so the last chunk is partial.  The largest relative
+differences are printed:
+
+    python EvaluateAtPoints.py [NTimes] [NPoints]
+
+The matrix product is done by `ComplexMatrixProduct`, which calls
+`cblas_zgemm` when GWFrames is built with GWFRAMES_BLAS set (and so
+with USE_CBLAS), and its own blocked loops otherwise; run this with
+both builds.
+
+"""
+from __future__ import division, print_function
+import sys
+import numpy as np
+import Quaternions
+import GWFrames
+
+NTimes = int(sys.argv[1]) if len(sys.argv)>1 else 5000
+NPoints = int(sys.argv[2]) if len(sys.argv)>2 else 17
+ellMax = 6
+Tolerance = 1e-12
+
+np.random.seed(1234)
+T = np.linspace(0., 100., num=NTimes)
+LM = [[l,m] for l in range(2,ellMax+1) for m in range(-l,l+1)]
+Data = np.random.normal(size=(len(LM), NTimes)) + 1j*np.random.normal(size=(len(LM), NTimes))
+Points = list(zip(np.arccos(np.random.uniform(-1,1,size=NPoints)), np.random.uniform(0,2*np.pi,size=NPoints)))
+varthetas = [vartheta for vartheta,varphi in Points]
+varphis = [varphi for vartheta,varphi in Points]
+
+def RandomRotor():
+    q = np.random.normal(size=4)
+    return Quaternions.Quaternion(*(q/np.linalg.norm(q)))
+
+def MakeWaveform(LM, Data, Frame):
+    W = GWFrames.Waveform(T, LM, Data)
+    if Frame:
+        W.SetFrame(Frame)
+        W.SetFrameType(GWFrames.Corotating)
+    else:
+        W.SetFrameType(GWFrames.Inertial)
+    return W
+
+Missing = [i for i,(l,m) in enumerate(LM) if not (l==3 and m==1)]
+Cases = [
+    ('Empty frame', MakeWaveform(LM, Data, [])),
+    ('Constant frame', MakeWaveform(LM, Data, [RandomRotor()])),
+    ('Time-dependent frame', MakeWaveform(LM, Data, [RandomRotor() for i in range(NTimes)])),
+    ('Incomplete modes', MakeWaveform([LM[i] for i in Missing], Data[Missing], [RandomRotor() for i in range(NTimes)])),
+]
+
+Failures = 0
+for Label,W in Cases:
+    for i_0,i_1 in [(0,-1), (17,NTimes-3)]:
+        Together = np.array(W.EvaluateAtPoints(varthetas, varphis, i_0, i_1))
+        Separately = np.array([W.EvaluateAtPoint(vartheta, varphi, i_0, i_1) for vartheta,varphi in Points])
+        Error = np.max(np.abs(Together-Separately)) / np.max(np.abs(Separately))
+        print("{0:<22s} [{1},{2}): {3:.3g}".format(Label, i_0, i_1, Error))
+        if Together.shape!=Separately.shape or not Error<Tolerance:
+            Failures += 1
+
+assert Failures==0
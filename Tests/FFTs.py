@@ -0,0 +1,71 @@
+"""Compare the FFT functions in fft.cpp with numpy.fft.
+
+Each transform is applied to random data of various lengths --
+including odd lengths and lengths that are not powers of 2 -- and the
+maximum difference from the equivalent numpy.fft result (with the
+conventions documented in fft.hpp: bare FFT sums, FFTW's sign, and
+Numerical Recipes' packing for `RealDFT`) is printed:
+
+    python FFTs.py
+
+"""
+from __future__ import division, print_function
+import numpy as np
+import GWFrames
+
+np.random.seed(1234)
+Tolerance = 1e-12
+Failures = []
+
+def Check(Label, n, a, b):
+    a, b = np.asarray(a), np.asarray(b)
+    Error = np.max(np.abs(a-b)) / max(1.0, np.max(np.abs(b))) if b.size else 0.0
+    print("{0:<16s} n={1:<5d} {2:.3g}".format(Label, n, Error))
+    if a.shape!=b.shape or Error>Tolerance:
+        Failures.append((Label, n))
+
+for n in [1, 2, 3, 7, 12, 15, 30, 64, 97, 210, 1000, 1024, 4095]:
+    z = np.random.normal(size=n) + 1j*np.random.normal(size=n)
+    x = np.random.normal(size=n)
+    Interleaved = np.column_stack((z.real, z.imag)).flatten()
+
+    Check("DFT", n, GWFrames.DFT(z), np.fft.fft(z))
+    Check("IDFT", n, GWFrames.IDFT(z), n*np.fft.ifft(z))
+    Check("DFTInterleaved", n, GWFrames.DFTInterleaved(Interleaved),
+          np.column_stack((np.fft.fft(z).real, np.fft.fft(z).imag)).flatten())
+    Check("IDFTInterleaved", n, GWFrames.IDFTInterleaved(Interleaved),
+          np.column_stack(((n*np.fft.ifft(z)).real, (n*np.fft.ifft(z)).imag)).flatten())
+    Check("rdft", n, GWFrames.rdft(x), np.fft.rfft(x))
+    Check("irdft", n, GWFrames.irdft(np.fft.rfft(x), n), n*x)
+
+    if n%2==0:
+        R = np.fft.rfft(x)
+        Packed = np.empty(n)
+        Packed[0], Packed[1] = R[0].real, R[n//2].real
+        Packed[2::2], Packed[3::2] = R[1:n//2].real, R[1:n//2].imag
+        Check("RealDFT", n, GWFrames.RealDFT(x), Packed)
+
+    # Response of odd length m, in wrap-around order, as in Numerical Recipes
+    m = min(n, 5) if n%2 else min(n-1, 5)
+    if m>0:
+        respns = np.random.normal(size=m)
+        respns[0] += 10.0 # So that deconvolution is well conditioned
+        temp = np.zeros(n)
+        temp[0] = respns[0]
+        for i in range(1, (m+1)//2):
+            temp[i], temp[n-i] = respns[i], respns[m-i]
+        Convolved = np.real(np.fft.ifft(np.fft.fft(x)*np.fft.fft(temp)))
+        Check("convlv", n, GWFrames.convlv(x, respns, 1), Convolved)
+        Check("convlv (inverse)", n, GWFrames.convlv(Convolved, respns, -1), x)
+
+for N in [1, 2, 5, 100, 1000, 1001]:
+    n = GWFrames.NextFastFFTSize(N)
+    m = n//2
+    for p in [2, 3, 5, 7]:
+        while m%p==0:
+            m //= p
+    if n<max(N,2) or n%2 or m!=1:
+        Failures.append(("NextFastFFTSize", N))
+
+assert not Failures, "Failures: {0}".format(Failures)
+print("All FFTs agree with numpy.fft")
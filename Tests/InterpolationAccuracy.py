@@ -0,0 +1,93 @@
+"""Compare the accuracy and speed of the Waveform interpolation methods.
+
+An analytic chirp-like waveform is sampled on a uniform and on a
+nonuniform time grid, then interpolated to a finer grid with the
+cubic spline (`Interpolate`) and with local Lagrange polynomials of
+several orders (`InterpolateLocal`).  The maximum errors relative to
+the exact values are printed along with the best timings.  Then a PN
+waveform is interpolated by each method and compared with an
+independent natural cubic spline; each must agree to within a stated
+tolerance:
+
+    python InterpolationAccuracy.py [NTimes] [ellMax]
+
+"""
+from __future__ import division, print_function
+import sys
+import timeit
+import numpy as np
+import GWFrames
+
+NTimes = int(sys.argv[1]) if len(sys.argv)>1 else 20000
+ellMax = int(sys.argv[2]) if len(sys.argv)>2 else 8
+
+LM = [[l,m] for l in range(2,ellMax+1) for m in range(-l,l+1)]
+
+def Exact(T):
+    Phase = 0.05*T + 1.e-5*T**2
+    return np.array([(1.0+0.1*l)*np.exp(1j*(m*Phase+0.1*l)) * (1.0+1.e-4*T) for l,m in LM])
+
+def AnalyticWaveform(T):
+    W = GWFrames.Waveform(T, LM, Exact(T))
+    W.SetFrameType(GWFrames.Inertial)
+    return W
+
+def Time(Statement, Number=3):
+    return min(timeit.repeat(Statement, repeat=Number, number=1))
+
+Uniform = np.linspace(0., 2000., num=NTimes)
+np.random.seed(1234)
+Nonuniform = np.sort(np.concatenate(([0.], 2000.*np.random.uniform(size=NTimes-2), [2000.])))
+NewTime = np.linspace(10., 1990., num=4*NTimes)
+Truth = Exact(NewTime)
+
+print("NTimes={0}, ellMax={1}, NewTimes={2}".format(NTimes, ellMax, len(NewTime)))
+for Label, T in [("uniform", Uniform), ("nonuniform", Nonuniform)]:
+    W = AnalyticWaveform(T)
+    Methods = [("Interpolate", lambda: W.Interpolate(NewTime))]
+    Methods += [("InterpolateLocal({0})".format(Order), (lambda Order=Order: W.InterpolateLocal(NewTime, Order)))
+                for Order in [3, 5, 7]]
+    print("\n{0} input times".format(Label))
+    for Name, Method in Methods:
+        assert isinstance(Method(), GWFrames.Waveform) # Not the bare _Waveform
+        Error = np.max(np.abs(Method().Data()-Truth))
+        print("{0:<24s} max error {1:10.3e}  {2:10.4f} s".format(Name, Error, Time(Method)))
+
+# Check a PN waveform against an independent natural cubic spline
+# (the same spline as GSL's cspline, which `Interpolate` used before
+# `WaveformSpline`).  The spline path must agree to round-off; the
+# local polynomials must agree to within the stated tolerances, at
+# interior times where the spline's end conditions do not matter.
+def NaturalCubicSpline(T, Y, NewT):
+    h = np.diff(T)
+    n = len(T)
+    r = np.zeros_like(Y)
+    r[:, 1:-1] = 6*((Y[:, 2:]-Y[:, 1:-1])/h[1:] - (Y[:, 1:-1]-Y[:, :-2])/h[:-1])
+    # Thomas algorithm for the second derivatives, with zeros at the ends
+    c, d = np.zeros(n), np.zeros_like(Y)
+    for i in range(1, n-1):
+        m = 2*(h[i-1]+h[i]) - h[i-1]*c[i-1]
+        c[i] = h[i]/m
+        d[:, i] = (r[:, i] - h[i-1]*d[:, i-1])/m
+    M = np.zeros_like(Y)
+    for i in range(n-2, 0, -1):
+        M[:, i] = d[:, i] - c[i]*M[:, i+1]
+    i = np.clip(np.searchsorted(T, NewT)-1, 0, n-2)
+    a, b, hi = (T[i+1]-NewT)/h[i], (NewT-T[i])/h[i], h[i]
+    return a*Y[:, i] + b*Y[:, i+1] + ((a**3-a)*M[:, i] + (b**3-b)*M[:, i+1])*hi**2/6
+
+Tolerances = [("Interpolate", 1e-12), ("InterpolateLocal(5)", 1e-5), ("InterpolateLocal(7)", 1e-5)]
+PN = GWFrames.Waveform(GWFrames.PNWaveform('TaylorT4', 0.0, [0.1, 0.2, 0.3], [-0.2, 0.1, 0.0], 0.01))
+T = PN.T()
+NewTime = np.linspace(T[0]+0.05*(T[-1]-T[0]), T[-1]-0.05*(T[-1]-T[0]), num=2*len(T))
+Reference = NaturalCubicSpline(T, PN.Data(), NewTime)
+Scale = np.max(np.abs(Reference))
+print("\nPN waveform, relative to a natural cubic spline")
+for Name, Tolerance in Tolerances:
+    if Name=="Interpolate":
+        Result = PN.Interpolate(NewTime)
+    else:
+        Result = PN.InterpolateLocal(NewTime, int(Name[-2]))
+    Error = np.max(np.abs(Result.Data()-Reference)) / Scale
+    print("{0:<24s} max error {1:10.3e}  (tolerance {2:.0e})".format(Name, Error, Tolerance))
+    assert Error<Tolerance
@@ -0,0 +1,68 @@
+"""Compare MatchBank with pairwise WaveformAtAPointFT.Match.
+
+A chirp-like waveform is evaluated at several sky positions, and the
+resulting WaveformAtAPointFT objects are added to a MatchBank.  The
+bank's `Matches` and `MatchMatrix` results are compared with
+`WaveformAtAPointFT.Match` on normalized copies of each pair, and a
+waveform with zero SNR must be rejected by the bank:
+
+    python MatchBank.py [NPoints]
+
+"""
+from __future__ import division, print_function
+import sys
+import numpy as np
+import GWFrames
+
+NPoints = int(sys.argv[1]) if len(sys.argv)>1 else 6
+Tolerance = 1e-10
+
+LM = [[l,m] for l in range(2,5) for m in range(-l,l+1)]
+T = np.linspace(0., 4000., num=20000)
+Phase = 0.05*T + 1.e-5*T**2
+Data = np.array([(1.0+0.1*l)*np.exp(1j*(m*Phase+0.1*l)) * (1.0+1.e-4*T) for l,m in LM])
+W = GWFrames.Waveform(T, LM, Data)
+W.SetFrameType(GWFrames.Inertial)
+
+Dt, TotalMass = 0.2, 40.0
+np.random.seed(1234)
+Points = [(np.arccos(np.random.uniform(-1,1)), np.random.uniform(0,2*np.pi)) for i in range(NPoints)]
+Modes = GWFrames.WaveformModesFT(W, Dt, TotalMass)
+
+def AtPoints():
+    return [GWFrames.WaveformAtAPointFT(Modes, vartheta, varphi) for vartheta,varphi in Points]
+
+# The bank normalizes its own copies; Match needs normalized inputs
+A = AtPoints()
+Bank = GWFrames.MatchBank(A[0].F())
+for a in A:
+    Bank.Add(a)
+InversePSD = Bank.InversePSD()
+for a in A:
+    a.Normalize(InversePSD)
+Pairwise = np.array([[a.Match(b, InversePSD) for b in A] for a in A])
+
+Failures = 0
+def Check(Label, Result, Expected):
+    global Failures
+    Error = np.max(np.abs(np.asarray(Result)-Expected))
+    print("{0:<24s} {1:.3g}".format(Label, Error))
+    if np.asarray(Result).shape!=Expected.shape or Error>Tolerance:
+        Failures += 1
+
+# Pairwise matches of a waveform with itself should be 1, as the bank assumes
+np.fill_diagonal(Pairwise, 1.0)
+Check("Matches", np.array([Bank.Matches(a) for a in A]), Pairwise)
+Check("MatchMatrix()", np.array(Bank.MatchMatrix()), Pairwise)
+Check("MatchMatrix(Bank)", np.array(Bank.MatchMatrix(Bank)), Pairwise)
+
+Zero = GWFrames.Waveform(T, LM, 0.0*Data)
+Zero.SetFrameType(GWFrames.Inertial)
+try:
+    Bank.Add(GWFrames.WaveformAtAPointFT(GWFrames.WaveformModesFT(Zero, Dt, TotalMass), 0.0, 0.0))
+    print("Zero-SNR waveform: FAILED (no exception)")
+    Failures += 1
+except Exception:
+    print("Zero-SNR waveform: rejected")
+
+assert Failures==0
@@ -0,0 +1,41 @@
+"""Time the functions that look up many (ell,m) modes per time step.
+
+Run this against two builds of GWFrames (e.g., before and after a
+change to `FindModeIndex`) to compare the costs of `DipoleMoment`,
+`NormalizedAntisymmetry`, and `Scri` construction:
+
+    python ModeIndexBenchmark.py [NTimes] [ellMax]
+
+"""
+from __future__ import division, print_function
+import sys
+import timeit
+import numpy as np
+import GWFrames
+
+NTimes = int(sys.argv[1]) if len(sys.argv)>1 else 20000
+ellMax = int(sys.argv[2]) if len(sys.argv)>2 else 8
+
+def RandomWaveform(spinweight, ellMin=0):
+    np.random.seed(1234+spinweight)
+    T = np.linspace(0., 1000., num=NTimes)
+    LM = [[l,m] for l in range(ellMin,ellMax+1) for m in range(-l,l+1)]
+    Data = np.random.normal(size=(len(LM), len(T))) + 1j*np.random.normal(size=(len(LM), len(T)))
+    W = GWFrames.Waveform(T, LM, Data)
+    W.SetSpinWeight(spinweight)
+    W.SetFrameType(GWFrames.Inertial)
+    return W
+
+def Time(Label, Statement, Number=3):
+    Best = min(timeit.repeat(Statement, repeat=Number, number=1))
+    print("{0:<28s} {1:10.4f} s".format(Label, Best))
+
+h = RandomWaveform(-2, ellMin=2)
+psi = [RandomWaveform(s) for s in [2, 1, 0, -1, -2]]
+sigma = RandomWaveform(2)
+
+print("NTimes={0}, ellMax={1}".format(NTimes, ellMax))
+Time("FindModeIndex (x10^5)", lambda: [h.FindModeIndex(ellMax, ellMax) for i in range(100000)])
+Time("DipoleMoment", lambda: h.DipoleMoment())
+Time("NormalizedAntisymmetry", lambda: h.NormalizedAntisymmetry())
+Time("Scri construction", lambda: GWFrames.Scri(psi[0], psi[1], psi[2], psi[3], psi[4], sigma))
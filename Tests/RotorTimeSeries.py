@@ -0,0 +1,69 @@
+"""Compare `RotorTimeSeries` with `Quaternions.Squad`.
+
+A smoothly varying rotor is sampled on a nonuniform time grid.  The
+interpolant is evaluated at the sample times and at the midpoints
+between them, with and without constant rotors applied on either
+side, and compared with `Quaternions.Squad` on the original data.  At
+the end points, the interpolant must return the first and last
+rotors exactly, and just beyond them it must continue smoothly (it
+extrapolates from the first or last interval).  The largest
+differences, as rotation angles, are printed:
+
+    python RotorTimeSeries.py [NTimes]
+
+"""
+from __future__ import division, print_function
+import sys
+import numpy as np
+import Quaternions
+import GWFrames
+
+NTimes = int(sys.argv[1]) if len(sys.argv)>1 else 1000
+Tolerance = 1e-12
+
+np.random.seed(1234)
+T = np.sort(np.concatenate(([0.], 100.*np.random.uniform(size=NTimes-2), [100.])))
+R = [Quaternions.exp(Quaternions.Quaternion(0, 0.3*np.sin(0.1*t), 0.2*np.cos(0.07*t), 0.05*t)) for t in T]
+Midpoints = list((T[1:]+T[:-1])/2.)
+R_left = Quaternions.exp(Quaternions.Quaternion(0, 0.1, -0.2, 0.3))
+R_right = Quaternions.exp(Quaternions.Quaternion(0, -0.3, 0.1, 0.2))
+
+def RotorAngle(q):
+    return 2*np.arccos(min(1.0, abs(q[0])))
+
+def MaxAngle(Ra, Rb):
+    assert len(Ra)==len(Rb)
+    return max(RotorAngle(a*b.inverse()) for a,b in zip(Ra, Rb))
+
+Failures = 0
+def Check(Label, Error, Tolerance=Tolerance):
+    global Failures
+    print("{0:<36s} {1:.3g}".format(Label, Error))
+    if not Error<Tolerance:
+        Failures += 1
+
+S = GWFrames.RotorTimeSeries(R, list(T))
+Check("Sample times", MaxAngle(S.Evaluate(list(T)), Quaternions.Squad(R, list(T), list(T))))
+Check("Sample times vs. data", MaxAngle(S.Evaluate(list(T)), R))
+Check("Midpoints", MaxAngle(S.Evaluate(Midpoints), Quaternions.Squad(R, list(T), Midpoints)))
+Offset = 0.25*(T[1]-T[0])
+Check("Midpoints with offset", MaxAngle(S.Evaluate(Midpoints[1:-1], Offset),
+                                        Quaternions.Squad(R, list(T), [t+Offset for t in Midpoints[1:-1]])))
+Check("Midpoints with R_left, R_right", MaxAngle(S.Evaluate(Midpoints, 0.0, R_left, R_right),
+                                                 Quaternions.Squad([R_left*r*R_right for r in R], list(T), Midpoints)))
+Check("Single-time evaluation", MaxAngle([S.Evaluate(t) for t in Midpoints[::50]],
+                                         Quaternions.Squad(R, list(T), Midpoints[::50])))
+
+# The end points, and a little beyond them
+Check("First rotor", RotorAngle(S.Evaluate(T[0])*R[0].inverse()))
+Check("Last rotor", RotorAngle(S.Evaluate(T[-1])*R[-1].inverse()))
+for Label,t,r,dt in [("Before the first time", T[0], R[0], T[1]-T[0]), ("After the last time", T[-1], R[-1], T[-1]-T[-2])]:
+    Beyond = S.Evaluate(t + (1e-3*dt if t==T[-1] else -1e-3*dt))
+    Check(Label, RotorAngle(Beyond*r.inverse()), 1e-2*np.max([RotorAngle(R[i+1]*R[i].inverse()) for i in range(NTimes-1)]))
+    Check(Label+" (norm)", abs(Beyond.abs()-1.0))
+
+# A single rotor is a constant
+Constant = GWFrames.RotorTimeSeries([R_left], [0.0])
+Check("Constant rotor", MaxAngle(Constant.Evaluate(list(T)), [R_left]*NTimes))
+
+assert Failures==0
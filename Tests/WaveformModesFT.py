@@ -0,0 +1,46 @@
+"""Compare the two ways of constructing WaveformAtAPointFT objects.
+
+An analytic chirp-like waveform is converted to WaveformAtAPointFT
+objects at many sky positions, both directly from the Waveform and
+from the transformed modes in a WaveformModesFT.  The smallest match
+between the two constructions is printed along with the timings:
+
+    python WaveformModesFT.py [NPoints] [ellMax]
+
+"""
+from __future__ import division, print_function
+import sys
+import timeit
+import numpy as np
+import GWFrames
+
+NPoints = int(sys.argv[1]) if len(sys.argv)>1 else 20
+ellMax = int(sys.argv[2]) if len(sys.argv)>2 else 4
+
+LM = [[l,m] for l in range(2,ellMax+1) for m in range(-l,l+1)]
+T = np.linspace(0., 4000., num=40000)
+Phase = 0.05*T + 1.e-5*T**2
+Data = np.array([(1.0+0.1*l)*np.exp(1j*(m*Phase+0.1*l)) * (1.0+1.e-4*T) for l,m in LM])
+W = GWFrames.Waveform(T, LM, Data)
+W.SetFrameType(GWFrames.Inertial)
+
+Dt, TotalMass = 0.2, 40.0
+np.random.seed(1234)
+Points = [(np.arccos(np.random.uniform(-1,1)), np.random.uniform(0,2*np.pi)) for i in range(NPoints)]
+
+def Direct():
+    return [GWFrames.WaveformAtAPointFT(W, Dt, vartheta, varphi, TotalMass) for vartheta,varphi in Points]
+
+def FromModes():
+    Modes = GWFrames.WaveformModesFT(W, Dt, TotalMass)
+    return [GWFrames.WaveformAtAPointFT(Modes, vartheta, varphi) for vartheta,varphi in Points]
+
+A = Direct()
+B = FromModes()
+Bank = GWFrames.MatchBank(A[0].F())
+for b in B:
+    Bank.Add(b)
+print("NPoints={0}, ellMax={1}, NFreq={2}".format(NPoints, ellMax, A[0].NFreq()))
+print("Minimum match: {0:.8f}".format(min(Bank.Matches(a)[i] for i,a in enumerate(A))))
+print("Direct:     {0:10.4f} s".format(min(timeit.repeat(Direct, repeat=3, number=1))))
+print("From modes: {0:10.4f} s".format(min(timeit.repeat(FromModes, repeat=3, number=1))))
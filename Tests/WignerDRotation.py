@@ -0,0 +1,47 @@
+"""Check the time-blocked Wigner-D rotation of Waveform modes.
+
+A random Waveform is rotated by a random rotor at each time step with
+`RotateDecompositionBasis`, which applies the D matrices in blocks of
+time steps.  The result is compared with rotating each time step
+separately, as a one-step Waveform by a constant rotor, and must
+agree to round-off.  The rotated Waveform is also evaluated at random
+points, which must give the same values as the original Waveform:
+
+    python WignerDRotation.py [NTimes] [ellMax]
+
+"""
+from __future__ import division, print_function
+import sys
+import numpy as np
+import Quaternions
+import GWFrames
+
+# Not a multiple of the block size, so that the last block is partial
+NTimes = int(sys.argv[1]) if len(sys.argv)>1 else 1037
+ellMax = int(sys.argv[2]) if len(sys.argv)>2 else 8
+
+np.random.seed(1234)
+T = np.linspace(0., 100., num=NTimes)
+LM = [[l,m] for l in range(2,ellMax+1) for m in range(-l,l+1)]
+Data = np.random.normal(size=(len(LM), NTimes)) + 1j*np.random.normal(size=(len(LM), NTimes))
+W = GWFrames.Waveform(T, LM, Data)
+W.SetFrameType(GWFrames.Inertial)
+
+q = np.random.normal(size=(NTimes, 4))
+q /= np.sqrt(np.sum(q**2, axis=1))[:, np.newaxis]
+R = [Quaternions.Quaternion(*q_i) for q_i in q]
+
+Blocked = GWFrames.Waveform(W).RotateDecompositionBasis(R)
+PerStep = np.empty_like(Data)
+for i_t in range(NTimes):
+    PerStep[:, i_t] = W.SliceOfTimeIndices(i_t, i_t+1).RotateDecompositionBasis(R[i_t]).Data()[:, 0]
+Error = np.max(np.abs(Blocked.Data()-PerStep)) / np.max(np.abs(PerStep))
+print("Blocked vs. per-step rotation: {0:.3g}".format(Error))
+assert Error<1e-13
+
+for vartheta,varphi in zip(np.arccos(np.random.uniform(-1,1,size=5)), np.random.uniform(0,2*np.pi,size=5)):
+    a = np.array(W.EvaluateAtPoint(vartheta, varphi))
+    b = np.array(Blocked.EvaluateAtPoint(vartheta, varphi))
+    Error = np.max(np.abs(a-b)) / np.max(np.abs(a))
+    print("Evaluated at ({0:.3f}, {1:.3f}): {2:.3g}".format(vartheta, varphi, Error))
+    assert Error<1e-12